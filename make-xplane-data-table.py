@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+#
+# make-xplane-data-table.py
+#
+# Generates the constant X-Plane DATA label tables used by packet-xplane.c,
+# together with a protocol field for each labelled DATA index
+# (xplane.data.<index>) and value (xplane.data.<index>.<value>).
+#
+# Usage: make-xplane-data-table.py <output header> <major>=<labels.csv> [<major>=<overlay.csv> ...]
+#
+# The first file is the full table for its X-Plane major version. Each
+# following file only lists the cells that differ in a later version; they
+# are applied on top of the table before them. A row with an empty label
+# clears that cell. An overlay must list at least one difference, so a
+# version is only offered once its table is really different.
+#
+# All tables share one string pool and one set of fields, so a label or
+# field that is the same in several versions is only stored once.
+#
+# SPDX-License-Identifier: GPL-2.0-or-later
+#
+
+import csv
+import re
+import sys
+
+MAX_DATA_INDEX = 139
+COLUMNS = 9
+
+FIELD_RE = re.compile(r'^[a-z][a-z0-9_]*$')
+# Names already used by the hand written xplane.data.* fields.
+RESERVED_FIELDS = {'index', 'present', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'}
+
+EMPTY = ('', None, None)
+
+
+def c_string(value):
+    escaped = value.replace('\\', '\\\\').replace('"', '\\"')
+    return '"' + escaped + '"'
+
+
+def read_labels(path, table):
+    seen = set()
+    with open(path, newline='', encoding='utf-8') as f:
+        lines = (line for line in f if not line.startswith('#'))
+        for record, row in enumerate(csv.DictReader(lines), start=1):
+            index = int(row['index'])
+            column = int(row['column'])
+            if not 0 <= index < MAX_DATA_INDEX or not 0 <= column < COLUMNS:
+                sys.exit('{}: record {}: index {} column {} is out of range'.format(path, record, index, column))
+            if (index, column) in seen:
+                sys.exit('{}: record {}: duplicate index {} column {}'.format(path, record, index, column))
+            seen.add((index, column))
+            label = row['label'].strip()
+            field = row['field'].strip()
+            if label and not FIELD_RE.match(field):
+                sys.exit('{}: record {}: field "{}" is not a valid field name'.format(path, record, field))
+            table[index][column] = (label, field, row['dataref'].strip() or None) if label else EMPTY
+    check_fields(path, table)
+    return len(seen)
+
+
+def check_fields(path, table):
+    groups = set()
+    for index, row in enumerate(table):
+        group = row[0][1]
+        if group is None:
+            sys.exit('{}: index {} has no title'.format(path, index))
+        if group in RESERVED_FIELDS or group in groups:
+            sys.exit('{}: index {} field "{}" is already used'.format(path, index, group))
+        groups.add(group)
+        names = set()
+        for column in range(1, COLUMNS):
+            field = row[column][1]
+            if field is None:
+                continue
+            if field in names:
+                sys.exit('{}: index {} column {} field "{}" is already used'.format(path, index, column, field))
+            names.add(field)
+
+
+class StringPool:
+    def __init__(self):
+        self.data = ['']
+        self.offsets = {'': 0}
+        self.size = 1
+
+    def add(self, value):
+        if value is None:
+            value = ''
+        if value not in self.offsets:
+            self.offsets[value] = self.size
+            self.data.append(value)
+            self.size += len(value.encode('utf-8')) + 1
+            if self.size > 0xFFFF:
+                sys.exit('DATA label string pool is larger than 64KiB')
+        return self.offsets[value]
+
+
+def build(versions):
+    pool = StringPool()
+    fields = [None]         # slot 0 means "no field"
+    slots = {}
+    tables = []
+    for _, table in versions:
+        cells = []
+        for index, row in enumerate(table):
+            group = row[0][1]
+            out = []
+            for column, (label, field, dataref) in enumerate(row):
+                slot = 0
+                if field is not None:
+                    if column == 0:
+                        abbrev = 'xplane.data.{}'.format(group)
+                        info = (label, abbrev, 'FT_NONE', 'DATA Index {}'.format(index))
+                    else:
+                        abbrev = 'xplane.data.{}.{}'.format(group, field)
+                        info = (label, abbrev, 'FT_FLOAT', 'DataRef ' + dataref if dataref else None)
+                    if abbrev not in slots:
+                        slots[abbrev] = len(fields)
+                        fields.append(info)
+                    slot = slots[abbrev]
+                out.append((pool.add(label), pool.add(dataref), slot))
+            cells.append(out)
+        tables.append(cells)
+    return pool, fields, tables
+
+
+def write_header(path, versions):
+    pool, fields, tables = build(versions)
+    out = []
+    out.append('/* Generated by make-xplane-data-table.py from {}. Do not edit. */'.format(
+        ', '.join(source for (_, source), _ in versions)))
+    out.append('')
+    out.append('#define xplane_DATA_TABLE_COUNT {}'.format(len(versions)))
+    out.append('')
+    out.append('static const char xplane_data_strings[] =')
+    for value in pool.data:
+        out.append('    {}"\\0"'.format(c_string(value)))
+    out[-1] += ';'
+    out.append('')
+    out.append('/* X-Plane major version each table applies from. */')
+    out.append('static const guint xplane_data_table_versions[xplane_DATA_TABLE_COUNT] = {{ {} }};'.format(
+        ', '.join(str(major) for (major, _), _ in versions)))
+    out.append('')
+    out.append('static const enum_val_t xplane_data_table_enum_vals[] =\n{')
+    out.append('    { "auto", "Automatic (from the BECN version)", -1 },')
+    for number, ((major, _), _) in enumerate(versions):
+        out.append('    {{ "xp{0}", "X-Plane {0}", {1} }},'.format(major, number))
+    out.append('    { NULL, NULL, 0 }')
+    out.append('};')
+    out.append('')
+    out.append('static const xplane_data_label_t xplane_data_tables[xplane_DATA_TABLE_COUNT][xplane_MAX_DATA_INDEX][{}] =\n{{'.format(COLUMNS))
+    for ((major, _), _), cells in zip(versions, tables):
+        out.append('    /* X-Plane {} */'.format(major))
+        out.append('    {')
+        for index, row in enumerate(cells):
+            out.append('        /* {} */ {{ {} }},'.format(index, ', '.join('{{ {}, {}, {} }}'.format(*cell) for cell in row)))
+        out.append('    },')
+    out.append('};')
+    out.append('')
+    out.append('static int hf_xplane_data_field[{}];'.format(len(fields)))
+    out.append('')
+    out.append('static hf_register_info hf_xplane_data_fields[] =\n{')
+    for slot, info in enumerate(fields):
+        if info is None:
+            continue
+        name, abbrev, ftype, blurb = info
+        out.append('    {{ &hf_xplane_data_field[{}], {{ {}, "{}", {}, BASE_NONE, NULL, 0, {}, HFILL }} }},'.format(
+            slot, c_string(name), abbrev, ftype, c_string(blurb) if blurb else 'NULL'))
+    out.append('};')
+    out.append('')
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit('Usage: {} <output.h> <major>=<labels.csv> [<major>=<overlay.csv> ...]'.format(sys.argv[0]))
+    versions = []
+    table = [[EMPTY for _ in range(COLUMNS)] for _ in range(MAX_DATA_INDEX)]
+    previous = 0
+    for argument in sys.argv[2:]:
+        major, _, path = argument.partition('=')
+        if not major.isdigit() or not path or int(major) <= previous:
+            sys.exit('{}: expected <major>=<file> in increasing version order'.format(argument))
+        previous = int(major)
+        table = [list(row) for row in table]
+        # An overlay without differences would only add a copy of the previous table.
+        if read_labels(path, table) == 0 and versions:
+            sys.exit('{}: no differences from X-Plane {}'.format(path, versions[-1][0][0]))
+        versions.append(((previous, path.replace('\\', '/').split('/')[-1]), table))
+    write_header(sys.argv[1], versions)
+
+
+if __name__ == '__main__':
+    main()
@@ -22,6 +22,8 @@
   */
 #include <config.h>
 
+#include <math.h>
+
 #if 0
   /* "System" includes used only as needed */
 #include <stdio.h>
@@ -35,11 +37,26 @@
 #include <epan/unit_strings.h>
 #include <epan/expert.h>
 #include <epan/conversation.h>
+#include <epan/tap.h>
+#include <epan/reassemble.h>
+#include <epan/export_object.h>
 
 #include <wsutil/plugins.h>
+#include <wsutil/report_message.h>
 #include <wsutil/str_util.h>
+#include <wsutil/pint.h>
 #include <wsutil/wmem/wmem_strbuf.h>
 
+#include "packet-xplane.h"
+
+#if defined(__AVX2__) && G_BYTE_ORDER == G_LITTLE_ENDIAN
+#define xplane_DATA_DECODE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) && G_BYTE_ORDER == G_LITTLE_ENDIAN
+#define xplane_DATA_DECODE_SSE2
+#include <emmintrin.h>
+#endif
+
 /* Prototypes */
 /* (Required to prevent [-Wmissing-prototypes] warnings */
 void proto_reg_handoff_xplane(void);
@@ -47,9 +64,17 @@ void proto_register_xplane(void);
 
 /* Initialize the protocol and registered fields */
 static int proto_xplane = -1;
+static int xplane_data_tap = -1;
+static int xplane_rref_tap = -1;
+static int xplane_action_tap = -1;
+static int xplane_flir_tap = -1;
+static int xplane_radr_tap = -1;
+static int xplane_position_tap = -1;
+static int xplane_cadence_tap = -1;
 static expert_field ei_xplane = EI_INIT;
 #define xplane_HEADER_LENGTH 5
 #define xplane_MIN_PACKET_LENGTH 5
+#define xplane_STRING_MIN_LENGTH (xplane_MIN_PACKET_LENGTH + 1)    // header and at least one character of its string
 
 // ---------- ACFN Declarations ----------
 #define xplane_ACFN_PACKET_LENGTH 165
@@ -115,6 +140,8 @@ static int hf_xplane_alrt_line4 = -1;
 static expert_field ei_xplane_alrt_length = EI_INIT;
 
 // ---------- BECN Declarations ----------
+#define xplane_BECN_MIN_LENGTH 22      // header, 16 fixed bytes and the name's '\0'
+
 static gint ett_xplane_becn = -1;
 
 static int hf_xplane_becn_header = -1;
@@ -135,12 +162,14 @@ static int hf_xplane_cmnd_command = -1;
 
 // ---------- DATA Declarations ----------
 #define xplane_DATA_STRUCT_LENGTH 36
+#define xplane_DATA_PRESENT_LENGTH ((xplane_MAX_DATA_INDEX + 7) / 8)
 #define xplane_DATA_INDEX_LENGTH 4
 
 static gint ett_xplane_data = -1;
 
 static int hf_xplane_data_header = -1;
 static int hf_xplane_data_index = -1;
+static int hf_xplane_data_present = -1;
 static int hf_xplane_data_a = -1;
 static int hf_xplane_data_b = -1;
 static int hf_xplane_data_c = -1;
@@ -152,6 +181,8 @@ static int hf_xplane_data_h = -1;
 
 static expert_field ei_xplane_data_length = EI_INIT;
 static expert_field ei_xplane_data_invalid_index = EI_INIT;
+static expert_field ei_xplane_data_nonfinite = EI_INIT;
+static expert_field ei_xplane_data_sentinel = EI_INIT;
 
 // ---------- DCOC Declarations ----------
 static gint ett_xplane_dcoc = -1;
@@ -203,6 +234,45 @@ static int hf_xplane_flir_out_width = -1;
 static int hf_xplane_flir_out_frameindex = -1;
 static int hf_xplane_flir_out_framecount = -1;
 static int hf_xplane_flir_out_imagedata = -1;
+static int hf_xplane_flir_out_image = -1;
+
+static gint ett_xplane_flir_fragment = -1;
+static gint ett_xplane_flir_fragments = -1;
+
+static int hf_xplane_flir_fragments = -1;
+static int hf_xplane_flir_fragment = -1;
+static int hf_xplane_flir_fragment_overlap = -1;
+static int hf_xplane_flir_fragment_overlap_conflicts = -1;
+static int hf_xplane_flir_fragment_multiple_tails = -1;
+static int hf_xplane_flir_fragment_too_long_fragment = -1;
+static int hf_xplane_flir_fragment_error = -1;
+static int hf_xplane_flir_fragment_count = -1;
+static int hf_xplane_flir_reassembled_in = -1;
+static int hf_xplane_flir_reassembled_length = -1;
+
+static expert_field ei_xplane_flir_out_index = EI_INIT;
+static expert_field ei_xplane_flir_out_size = EI_INIT;
+
+static int xplane_flir_eo_tap = -1;
+static reassembly_table xplane_flir_reassembly_table;
+
+static const fragment_items xplane_flir_frag_items =
+{
+    &ett_xplane_flir_fragment,
+    &ett_xplane_flir_fragments,
+    &hf_xplane_flir_fragments,
+    &hf_xplane_flir_fragment,
+    &hf_xplane_flir_fragment_overlap,
+    &hf_xplane_flir_fragment_overlap_conflicts,
+    &hf_xplane_flir_fragment_multiple_tails,
+    &hf_xplane_flir_fragment_too_long_fragment,
+    &hf_xplane_flir_fragment_error,
+    &hf_xplane_flir_fragment_count,
+    &hf_xplane_flir_reassembled_in,
+    &hf_xplane_flir_reassembled_length,
+    NULL,
+    "FLIR fragments"
+};
 
 // ---------- ISE4 Declarations ----------
 #define xplane_ISE4_PACKET_LENGTH 37
@@ -399,8 +469,10 @@ static int hf_xplane_rpos_out_vz = -1;
 static int hf_xplane_rpos_out_rollrate = -1;
 static int hf_xplane_rpos_out_pitchrate = -1;
 static int hf_xplane_rpos_out_yawrate = -1;
+static int hf_xplane_rpos_out_prediction_error = -1;
 
 static expert_field ei_xplane_rpos_out_length = EI_INIT;
+static expert_field ei_xplane_rpos_out_prediction = EI_INIT;
 
 // ---------- RREF IN Declarations ----------
 #define xplane_RREF_IN_PACKET_LENGTH 413
@@ -411,14 +483,22 @@ static int hf_xplane_rref_in_header = -1;
 static int hf_xplane_rref_in_frequency = -1;
 static int hf_xplane_rref_in_id = -1;
 static int hf_xplane_rref_in_dataref = -1;
+static int hf_xplane_rref_in_response = -1;
 
 // ---------- RREF OUT Declarations ----------
+#define xplane_RREF_OUT_STRUCT_LENGTH 8
+
 static gint ett_xplane_rref_out = -1;
 
 static int hf_xplane_rref_out_header = -1;
 static int hf_xplane_rref_out_id = -1;
 static int hf_xplane_rref_out_value = -1;
+static int hf_xplane_rref_out_dataref = -1;
 static int hf_xplane_rref_out_idlink = -1;
+static int hf_xplane_rref_out_delta = -1;
+static int hf_xplane_rref_out_latency = -1;
+
+static expert_field ei_xplane_rref_out_unsubscribed = EI_INIT;
 
 // ---------- SHUT Declarations ----------
 #define xplane_SHUT_PACKET_LENGTH xplane_MIN_PACKET_LENGTH
@@ -430,6 +510,8 @@ static int hf_xplane_shut_header = -1;
 static expert_field ei_xplane_shut_length = EI_INIT;
 
 // ---------- SIMO Declarations ----------
+#define xplane_SIMO_MIN_LENGTH 10      // header, action and at least one character of the filename
+
 static gint ett_xplane_simo = -1;
 
 static int hf_xplane_simo_header = -1;
@@ -519,6 +601,8 @@ static guint xplane_pref_udp_sender_port = xplane_UDP_SENDFROM_PORT;
 static guint xplane_pref_udp_external_app_port = xplane_UDP_EXTERNAL_APP_PORT;
 static guint xplane_pref_becn_port = xplane_BECN_PORT;
 
+static dissector_handle_t xplane_udp_handle;
+
 static const value_string xplane_vals_Becn_HostID[] = {
     { 1, "X-Plane" },
     { 2, "Plane Maker" },
@@ -532,9 +616,11 @@ static const value_string xplane_vals_MachineRole[] = {
     { 0, NULL }
 };
 
+#define xplane_START_LATLONG 6
+
 static const value_string xplane_vals_StartType[] = {
     { 5  , "RepeatLast" },
-    { 6  , "LatLong" },
+    { xplane_START_LATLONG, "LatLong" },
     { 7  , "GeneralArea" },
     { 8  , "NearestAirport" },
     { 9  , "SnapshotLoad" },
@@ -630,1289 +716,1842 @@ static const value_string xplane_vals_Simo_ActionID[] = {
     { 0, NULL }
 };
 
-#define xplane_MAX_DATA_INDEX 139
-static wmem_strbuf_t* xplane_data_lookup_table[xplane_MAX_DATA_INDEX][9];
-static gboolean xplane_data_lookup_table_is_populated = FALSE;
-
-static void xplane_populate_data_lookup_table(void)
-{
-    xplane_data_lookup_table[0][0] = wmem_strbuf_new(wmem_epan_scope(), "Frame Rate Info");
-    xplane_data_lookup_table[0][1] = wmem_strbuf_new(wmem_epan_scope(), "Actual Frame Rate");
-    xplane_data_lookup_table[0][2] = wmem_strbuf_new(wmem_epan_scope(), "Sim Frame Rate");
-    xplane_data_lookup_table[0][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[0][4] = wmem_strbuf_new(wmem_epan_scope(), "Frame Time (s) DataRef=sim/time/framerate_period");
-    xplane_data_lookup_table[0][5] = wmem_strbuf_new(wmem_epan_scope(), "CPU Time (s)");
-    xplane_data_lookup_table[0][6] = wmem_strbuf_new(wmem_epan_scope(), "GPU Time (s)  DataRef=sim/time/gpu_time_per_frame_sec_approx");
-    xplane_data_lookup_table[0][7] = wmem_strbuf_new(wmem_epan_scope(), "grnd ratio");
-    xplane_data_lookup_table[0][8] = wmem_strbuf_new(wmem_epan_scope(), "flit ratio (Requested Simulator Speed multiple from ctrl-T  DataRef=sim/time/sim_speed_actual");
-
-    xplane_data_lookup_table[1][0] = wmem_strbuf_new(wmem_epan_scope(), "Times");
-    xplane_data_lookup_table[1][1] = wmem_strbuf_new(wmem_epan_scope(), "Elapsed Sim Start (s)");
-    xplane_data_lookup_table[1][2] = wmem_strbuf_new(wmem_epan_scope(), "Elapsed Total Time (exc Start Screen) (s)");
-    xplane_data_lookup_table[1][3] = wmem_strbuf_new(wmem_epan_scope(), "Elapsed Mission Time (s)");
-    xplane_data_lookup_table[1][4] = wmem_strbuf_new(wmem_epan_scope(), "Elapsed Timer (s)");
-    xplane_data_lookup_table[1][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[1][6] = wmem_strbuf_new(wmem_epan_scope(), "Zulu Time  DataRef=sim/time/zulu_time_sec");
-    xplane_data_lookup_table[1][7] = wmem_strbuf_new(wmem_epan_scope(), "Simulator Local Time");
-    xplane_data_lookup_table[1][8] = wmem_strbuf_new(wmem_epan_scope(), "Hobbs Time DataRef=sim/time/hobbs_time");
-
-    xplane_data_lookup_table[2][0] = wmem_strbuf_new(wmem_epan_scope(), "Sim Stats");
-    xplane_data_lookup_table[2][1] = wmem_strbuf_new(wmem_epan_scope(), "USE (puffs)");
-    xplane_data_lookup_table[2][2] = wmem_strbuf_new(wmem_epan_scope(), "TOT (puffs)");
-    xplane_data_lookup_table[2][3] = wmem_strbuf_new(wmem_epan_scope(), "Triangles Visible");
-    xplane_data_lookup_table[2][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[2][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[2][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[2][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[2][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[3][0] = wmem_strbuf_new(wmem_epan_scope(), "Speeds");
-    xplane_data_lookup_table[3][1] = wmem_strbuf_new(wmem_epan_scope(), "Knots Indicated Airspeed");
-    xplane_data_lookup_table[3][2] = wmem_strbuf_new(wmem_epan_scope(), "Knots Equivalent Airspeed");
-    xplane_data_lookup_table[3][3] = wmem_strbuf_new(wmem_epan_scope(), "Knots True Airspeed");
-    xplane_data_lookup_table[3][4] = wmem_strbuf_new(wmem_epan_scope(), "Knots Tree Ground Speed");
-    xplane_data_lookup_table[3][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[3][6] = wmem_strbuf_new(wmem_epan_scope(), "Indicated (mph)");
-    xplane_data_lookup_table[3][7] = wmem_strbuf_new(wmem_epan_scope(), "True Airspeed (mph)");
-    xplane_data_lookup_table[3][8] = wmem_strbuf_new(wmem_epan_scope(), "True Ground Speed (mph)");
-
-    xplane_data_lookup_table[4][0] = wmem_strbuf_new(wmem_epan_scope(), "Mach, VVI, g-load");
-    xplane_data_lookup_table[4][1] = wmem_strbuf_new(wmem_epan_scope(), "Current Mach");
-    xplane_data_lookup_table[4][2] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[4][3] = wmem_strbuf_new(wmem_epan_scope(), "Vertical Velocity (feet per minute)");
-    xplane_data_lookup_table[4][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[4][5] = wmem_strbuf_new(wmem_epan_scope(), "Gload (normal)");
-    xplane_data_lookup_table[4][6] = wmem_strbuf_new(wmem_epan_scope(), "GLoad (axial)");
-    xplane_data_lookup_table[4][7] = wmem_strbuf_new(wmem_epan_scope(), "Gload (side)");
-    xplane_data_lookup_table[4][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[5][0] = wmem_strbuf_new(wmem_epan_scope(), "Weather");
-    xplane_data_lookup_table[5][1] = wmem_strbuf_new(wmem_epan_scope(), "Sea Level Pressure (inHG)");
-    xplane_data_lookup_table[5][2] = wmem_strbuf_new(wmem_epan_scope(), "Sea Level Temperature (degC)");
-    xplane_data_lookup_table[5][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[5][4] = wmem_strbuf_new(wmem_epan_scope(), "Wind Speed (knots)");
-    xplane_data_lookup_table[5][5] = wmem_strbuf_new(wmem_epan_scope(), "Wind From Direction 0=N->S  270=West->East");
-    xplane_data_lookup_table[5][6] = wmem_strbuf_new(wmem_epan_scope(), "Local Turbulance (0->1)");
-    xplane_data_lookup_table[5][7] = wmem_strbuf_new(wmem_epan_scope(), "Local Precipitation (0->1)");
-    xplane_data_lookup_table[5][8] = wmem_strbuf_new(wmem_epan_scope(), "Local Hail (0->1)");
-
-    xplane_data_lookup_table[6][0] = wmem_strbuf_new(wmem_epan_scope(), "Aircraft atmosphere");
-    xplane_data_lookup_table[6][1] = wmem_strbuf_new(wmem_epan_scope(), "Atmospheric Pressure (inHG)");
-    xplane_data_lookup_table[6][2] = wmem_strbuf_new(wmem_epan_scope(), "Atmospheric Temperature (degC)");
-    xplane_data_lookup_table[6][3] = wmem_strbuf_new(wmem_epan_scope(), "LE temp (degC)");
-    xplane_data_lookup_table[6][4] = wmem_strbuf_new(wmem_epan_scope(), "Aircraft Density Ratio");
-    xplane_data_lookup_table[6][5] = wmem_strbuf_new(wmem_epan_scope(), "A (ktas)");
-    xplane_data_lookup_table[6][6] = wmem_strbuf_new(wmem_epan_scope(), "Q Dynamic pressue (lbs / ft^2)");
-    xplane_data_lookup_table[6][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[6][8] = wmem_strbuf_new(wmem_epan_scope(), "Gravitational Force (feet/s^2)");
-
-    xplane_data_lookup_table[7][0] = wmem_strbuf_new(wmem_epan_scope(), "System pressures");
-    xplane_data_lookup_table[7][1] = wmem_strbuf_new(wmem_epan_scope(), "Barometric pressure (inHG)");
-    xplane_data_lookup_table[7][2] = wmem_strbuf_new(wmem_epan_scope(), "edens (part)");
-    xplane_data_lookup_table[7][3] = wmem_strbuf_new(wmem_epan_scope(), "Vacuum ratio");
-    xplane_data_lookup_table[7][4] = wmem_strbuf_new(wmem_epan_scope(), "Vacuum ratio");
-    xplane_data_lookup_table[7][5] = wmem_strbuf_new(wmem_epan_scope(), "Elec ratio");
-    xplane_data_lookup_table[7][6] = wmem_strbuf_new(wmem_epan_scope(), "Elec ratio");
-    xplane_data_lookup_table[7][7] = wmem_strbuf_new(wmem_epan_scope(), "AHRS ratio");
-    xplane_data_lookup_table[7][8] = wmem_strbuf_new(wmem_epan_scope(), "AHRS ratio");
-
-    xplane_data_lookup_table[8][0] = wmem_strbuf_new(wmem_epan_scope(), "Joystick aileron/elevator/rudder");
-    xplane_data_lookup_table[8][1] = wmem_strbuf_new(wmem_epan_scope(), "Elevator Full down = -1 Full Up = +1");
-    xplane_data_lookup_table[8][2] = wmem_strbuf_new(wmem_epan_scope(), "Aileron Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[8][3] = wmem_strbuf_new(wmem_epan_scope(), "Rudder  Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[8][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[8][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[8][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[8][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[8][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[9][0] = wmem_strbuf_new(wmem_epan_scope(), "Other Flight Controls");
-    xplane_data_lookup_table[9][1] = wmem_strbuf_new(wmem_epan_scope(), "Requested Thrust Vectoring");
-    xplane_data_lookup_table[9][2] = wmem_strbuf_new(wmem_epan_scope(), "Requested Wing Sweep");
-    xplane_data_lookup_table[9][3] = wmem_strbuf_new(wmem_epan_scope(), "Requested Wing Incidence");
-    xplane_data_lookup_table[9][4] = wmem_strbuf_new(wmem_epan_scope(), "Requested Wing Digedral");
-    xplane_data_lookup_table[9][5] = wmem_strbuf_new(wmem_epan_scope(), "Requested Wing Retration");
-    xplane_data_lookup_table[9][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[9][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[9][8] = wmem_strbuf_new(wmem_epan_scope(), "Water Jettisoned");
-
-    xplane_data_lookup_table[10][0] = wmem_strbuf_new(wmem_epan_scope(), "Artificial Stability Input");
-    xplane_data_lookup_table[10][1] = wmem_strbuf_new(wmem_epan_scope(), "Elevator Full down = -1 Full Up = +1");
-    xplane_data_lookup_table[10][2] = wmem_strbuf_new(wmem_epan_scope(), "Aileron Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[10][3] = wmem_strbuf_new(wmem_epan_scope(), "Rudder  Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[10][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[10][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[10][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[10][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[10][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[11][0] = wmem_strbuf_new(wmem_epan_scope(), "Flight Control Deflections");
-    xplane_data_lookup_table[11][1] = wmem_strbuf_new(wmem_epan_scope(), "Elevator Full down = -1 Full Up = +1");
-    xplane_data_lookup_table[11][2] = wmem_strbuf_new(wmem_epan_scope(), "Aileron Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[11][3] = wmem_strbuf_new(wmem_epan_scope(), "Rudder  Full Left = -1  Full Right = +1");
-    xplane_data_lookup_table[11][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[11][5] = wmem_strbuf_new(wmem_epan_scope(), "Nosewheel Degrees from forward. Negative = left, Positive = right");
-    xplane_data_lookup_table[11][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[11][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[11][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[12][0] = wmem_strbuf_new(wmem_epan_scope(), "Wing sweep and thrust vectoring");
-    xplane_data_lookup_table[12][1] = wmem_strbuf_new(wmem_epan_scope(), "Sweep 1 (degrees back from normal)");
-    xplane_data_lookup_table[12][2] = wmem_strbuf_new(wmem_epan_scope(), "Sweep 1 (degrees back from normal)");
-    xplane_data_lookup_table[12][3] = wmem_strbuf_new(wmem_epan_scope(), "Sweep (degrees back from normal)");
-    xplane_data_lookup_table[12][4] = wmem_strbuf_new(wmem_epan_scope(), "Vector Ratio");
-    xplane_data_lookup_table[12][5] = wmem_strbuf_new(wmem_epan_scope(), "Sweep ratio (to fully forward)");
-    xplane_data_lookup_table[12][6] = wmem_strbuf_new(wmem_epan_scope(), "Incidence ratio (to fully angled)");
-    xplane_data_lookup_table[12][7] = wmem_strbuf_new(wmem_epan_scope(), "Dihedral ratio (to fulyl angled)");
-    xplane_data_lookup_table[12][8] = wmem_strbuf_new(wmem_epan_scope(), "Retraction ratio (to fully angled)");
-
-    xplane_data_lookup_table[13][0] = wmem_strbuf_new(wmem_epan_scope(), "Trim / flaps / Slats / Speedbrakes");
-    xplane_data_lookup_table[13][1] = wmem_strbuf_new(wmem_epan_scope(), "Elevator trim");
-    xplane_data_lookup_table[13][2] = wmem_strbuf_new(wmem_epan_scope(), "Aileron trim");
-    xplane_data_lookup_table[13][3] = wmem_strbuf_new(wmem_epan_scope(), "Rudder trim");
-    xplane_data_lookup_table[13][4] = wmem_strbuf_new(wmem_epan_scope(), "Flap Requested (0->1)");
-    xplane_data_lookup_table[13][5] = wmem_strbuf_new(wmem_epan_scope(), "Flap Ratio (0->1)");
-    xplane_data_lookup_table[13][6] = wmem_strbuf_new(wmem_epan_scope(), "Slat Ratio");
-    xplane_data_lookup_table[13][7] = wmem_strbuf_new(wmem_epan_scope(), "Speedbrake Requested (0->1)");
-    xplane_data_lookup_table[13][8] = wmem_strbuf_new(wmem_epan_scope(), "Speedbrake Ratio (0->1)");
-
-    xplane_data_lookup_table[14][0] = wmem_strbuf_new(wmem_epan_scope(), "Gear and Brakes");
-    xplane_data_lookup_table[14][1] = wmem_strbuf_new(wmem_epan_scope(), "Gear Requested (0->1)");
-    xplane_data_lookup_table[14][2] = wmem_strbuf_new(wmem_epan_scope(), "wbrak, set");
-    xplane_data_lookup_table[14][3] = wmem_strbuf_new(wmem_epan_scope(), "Left Toe Brake requested");
-    xplane_data_lookup_table[14][4] = wmem_strbuf_new(wmem_epan_scope(), "Right Toe Brake requested");
-    xplane_data_lookup_table[14][5] = wmem_strbuf_new(wmem_epan_scope(), "wbrak, position");
-    xplane_data_lookup_table[14][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[14][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[14][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[15][0] = wmem_strbuf_new(wmem_epan_scope(), "Angular Moments");
-    xplane_data_lookup_table[15][1] = wmem_strbuf_new(wmem_epan_scope(), "M Roll Torque around X-axis (foot / lbs)");
-    xplane_data_lookup_table[15][2] = wmem_strbuf_new(wmem_epan_scope(), "L Roll Torque around Z-axis (foot / lbs)");
-    xplane_data_lookup_table[15][3] = wmem_strbuf_new(wmem_epan_scope(), "N Roll Torque around Y-axis (foot / lbs)");
-    xplane_data_lookup_table[15][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[15][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[15][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[15][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[15][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[16][0] = wmem_strbuf_new(wmem_epan_scope(), "Angular Velocities");
-    xplane_data_lookup_table[16][1] = wmem_strbuf_new(wmem_epan_scope(), "Q Pitch Rate (measued in Body-axes)");
-    xplane_data_lookup_table[16][2] = wmem_strbuf_new(wmem_epan_scope(), "P Roll Rate (measued in Body-axes)");
-    xplane_data_lookup_table[16][3] = wmem_strbuf_new(wmem_epan_scope(), "R Yaw Rate (measued in Body-axes)");
-    xplane_data_lookup_table[16][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[16][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[16][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[16][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[16][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[17][0] = wmem_strbuf_new(wmem_epan_scope(), "Pitch / Roll / Headings");
-    xplane_data_lookup_table[17][1] = wmem_strbuf_new(wmem_epan_scope(), "Pitch degrees (measured in body-axis Euler angles)");
-    xplane_data_lookup_table[17][2] = wmem_strbuf_new(wmem_epan_scope(), "Roll degrees (measured in body-axis Euler angles)");
-    xplane_data_lookup_table[17][3] = wmem_strbuf_new(wmem_epan_scope(), "True Heading (degrees)");
-    xplane_data_lookup_table[17][4] = wmem_strbuf_new(wmem_epan_scope(), "Magnetic Heading (degrees)");
-    xplane_data_lookup_table[17][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[17][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[17][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[17][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[18][0] = wmem_strbuf_new(wmem_epan_scope(), "Angle Of Attack, sideslip, paths");
-    xplane_data_lookup_table[18][1] = wmem_strbuf_new(wmem_epan_scope(), "Alpha - AoA (degrees)");
-    xplane_data_lookup_table[18][2] = wmem_strbuf_new(wmem_epan_scope(), "Beta slideslip (degrees)");
-    xplane_data_lookup_table[18][3] = wmem_strbuf_new(wmem_epan_scope(), "HPath (degrees)");
-    xplane_data_lookup_table[18][4] = wmem_strbuf_new(wmem_epan_scope(), "VPath (degrees)");
-    xplane_data_lookup_table[18][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[18][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[18][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[18][8] = wmem_strbuf_new(wmem_epan_scope(), "slip, degrees");
-
-    xplane_data_lookup_table[19][0] = wmem_strbuf_new(wmem_epan_scope(), "Magnetic Compass");
-    xplane_data_lookup_table[19][1] = wmem_strbuf_new(wmem_epan_scope(), "Magnetic Heading");
-    xplane_data_lookup_table[19][2] = wmem_strbuf_new(wmem_epan_scope(), "Magnetic Variation (from True)");
-    xplane_data_lookup_table[19][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[19][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[19][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[19][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[19][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[19][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[20][0] = wmem_strbuf_new(wmem_epan_scope(), "Global Position");
-    xplane_data_lookup_table[20][1] = wmem_strbuf_new(wmem_epan_scope(), "Latitude");
-    xplane_data_lookup_table[20][2] = wmem_strbuf_new(wmem_epan_scope(), "Longitude");
-    xplane_data_lookup_table[20][3] = wmem_strbuf_new(wmem_epan_scope(), "Altitude (ft above mean sea level)");
-    xplane_data_lookup_table[20][4] = wmem_strbuf_new(wmem_epan_scope(), "Altitude (ft above ground)");
-    xplane_data_lookup_table[20][5] = wmem_strbuf_new(wmem_epan_scope(), "Is On Runway?");
-    xplane_data_lookup_table[20][6] = wmem_strbuf_new(wmem_epan_scope(), "Indicated Altitude");
-    xplane_data_lookup_table[20][7] = wmem_strbuf_new(wmem_epan_scope(), "Latitude (bottom of containing Lat/Long scenery square)");
-    xplane_data_lookup_table[20][8] = wmem_strbuf_new(wmem_epan_scope(), "Longitude (left of containing Lat/Long scenery square)");
-
-    xplane_data_lookup_table[21][0] = wmem_strbuf_new(wmem_epan_scope(), "Distances Travelled");
-    xplane_data_lookup_table[21][1] = wmem_strbuf_new(wmem_epan_scope(), "X - relative to inertial axes");
-    xplane_data_lookup_table[21][2] = wmem_strbuf_new(wmem_epan_scope(), "Y - relative to inertial axes");
-    xplane_data_lookup_table[21][3] = wmem_strbuf_new(wmem_epan_scope(), "Z - relative to inertial axes");
-    xplane_data_lookup_table[21][4] = wmem_strbuf_new(wmem_epan_scope(), "vX (m/s) - relative to inertial axes");
-    xplane_data_lookup_table[21][5] = wmem_strbuf_new(wmem_epan_scope(), "vY (m/s) - relative to inertial axes");
-    xplane_data_lookup_table[21][6] = wmem_strbuf_new(wmem_epan_scope(), "vZ (m/s) - relative to inertial axes");
-    xplane_data_lookup_table[21][7] = wmem_strbuf_new(wmem_epan_scope(), "Distance (feet)");
-    xplane_data_lookup_table[21][8] = wmem_strbuf_new(wmem_epan_scope(), "Distance (nm)");
-
-    xplane_data_lookup_table[22][0] = wmem_strbuf_new(wmem_epan_scope(), "All Planes Latitude (A = User Aircraft)");
-    xplane_data_lookup_table[23][0] = wmem_strbuf_new(wmem_epan_scope(), "All Planes Longitude (A = User Aircraft)");
-    xplane_data_lookup_table[24][0] = wmem_strbuf_new(wmem_epan_scope(), "All Planes Altitude (feet above mean sea level) (A = User Aircraft)");
-    xplane_data_lookup_table[25][0] = wmem_strbuf_new(wmem_epan_scope(), "Throttle - Requested");
-    xplane_data_lookup_table[26][0] = wmem_strbuf_new(wmem_epan_scope(), "Throttle - Actual");
-    xplane_data_lookup_table[27][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine Mode (0=Feather, 1=Normal, 2-Beta and 3=Reverse)");
-    xplane_data_lookup_table[28][0] = wmem_strbuf_new(wmem_epan_scope(), "Propeller setting");
-    xplane_data_lookup_table[29][0] = wmem_strbuf_new(wmem_epan_scope(), "Mixture setting");
-    xplane_data_lookup_table[30][0] = wmem_strbuf_new(wmem_epan_scope(), "Carb heat");
-    xplane_data_lookup_table[31][0] = wmem_strbuf_new(wmem_epan_scope(), "Cowl flaps");
-    xplane_data_lookup_table[32][0] = wmem_strbuf_new(wmem_epan_scope(), "Magnetos");
-    xplane_data_lookup_table[33][0] = wmem_strbuf_new(wmem_epan_scope(), "Starter timeout");
-    xplane_data_lookup_table[34][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine power");
-    xplane_data_lookup_table[35][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine thrust");
-    xplane_data_lookup_table[36][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine torque");
-    xplane_data_lookup_table[37][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine RPM");
-    xplane_data_lookup_table[38][0] = wmem_strbuf_new(wmem_epan_scope(), "Propeller RPM");
-    xplane_data_lookup_table[39][0] = wmem_strbuf_new(wmem_epan_scope(), "Propeller Pitch");
-    xplane_data_lookup_table[40][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine Wash");
-    xplane_data_lookup_table[41][0] = wmem_strbuf_new(wmem_epan_scope(), "N1");
-    xplane_data_lookup_table[42][0] = wmem_strbuf_new(wmem_epan_scope(), "N2");
-    xplane_data_lookup_table[43][0] = wmem_strbuf_new(wmem_epan_scope(), "Manifold pressure");
-    xplane_data_lookup_table[44][0] = wmem_strbuf_new(wmem_epan_scope(), "EPR");
-    xplane_data_lookup_table[45][0] = wmem_strbuf_new(wmem_epan_scope(), "Fuel Flow");
-    xplane_data_lookup_table[46][0] = wmem_strbuf_new(wmem_epan_scope(), "ITT");
-    xplane_data_lookup_table[47][0] = wmem_strbuf_new(wmem_epan_scope(), "EGT");
-    xplane_data_lookup_table[48][0] = wmem_strbuf_new(wmem_epan_scope(), "CHT");
-    xplane_data_lookup_table[49][0] = wmem_strbuf_new(wmem_epan_scope(), "Oil pressure");
-    xplane_data_lookup_table[50][0] = wmem_strbuf_new(wmem_epan_scope(), "Oil temperature");
-    xplane_data_lookup_table[51][0] = wmem_strbuf_new(wmem_epan_scope(), "Fuel pressure");
-    xplane_data_lookup_table[52][0] = wmem_strbuf_new(wmem_epan_scope(), "Generator amps");
-    xplane_data_lookup_table[53][0] = wmem_strbuf_new(wmem_epan_scope(), "Battery amps");
-    xplane_data_lookup_table[54][0] = wmem_strbuf_new(wmem_epan_scope(), "Battery volts");
-    xplane_data_lookup_table[55][0] = wmem_strbuf_new(wmem_epan_scope(), "Electric fuel pump on/off");
-    xplane_data_lookup_table[56][0] = wmem_strbuf_new(wmem_epan_scope(), "Idle speed low/high");
-    xplane_data_lookup_table[57][0] = wmem_strbuf_new(wmem_epan_scope(), "Battery on/off");
-    xplane_data_lookup_table[58][0] = wmem_strbuf_new(wmem_epan_scope(), "Generator on/off");
-    xplane_data_lookup_table[59][0] = wmem_strbuf_new(wmem_epan_scope(), "Inverter on/off");
-    xplane_data_lookup_table[60][0] = wmem_strbuf_new(wmem_epan_scope(), "FADEC on/off");
-    xplane_data_lookup_table[61][0] = wmem_strbuf_new(wmem_epan_scope(), "Igniter on/off");
-    xplane_data_lookup_table[62][0] = wmem_strbuf_new(wmem_epan_scope(), "Fuel weights");
-
-    for (gint i = 22; i <= 62; i++)
-    {
-        for (gint j = 1; j <= 8; j++)
-        {
-            xplane_data_lookup_table[i][j] = wmem_strbuf_new(wmem_epan_scope(), "");
-        }
-    }
+// Column 0 titles the DATA index, columns 1-8 label the values A-H.
+// One table per X-Plane major version is generated at build time from xplane-data-labels*.csv.
+// The tables share one string pool and one set of per index/value fields.
+typedef struct xplane_data_label
+{
+    guint16 label;      // offset in xplane_data_strings, 0 is ""
+    guint16 dataref;    // offset in xplane_data_strings, 0 when not known
+    guint16 field;      // slot in hf_xplane_data_field, 0 when unlabelled
+} xplane_data_label_t;
+
+typedef const xplane_data_label_t (*xplane_data_labels_t)[xplane_DATA_VALUE_COUNT + 1];
+
+#include "xplane-data-table.h"
+
+#define xplane_PROTO_DATA_TABLE 0
 
-    xplane_data_lookup_table[63][0] = wmem_strbuf_new(wmem_epan_scope(), "Aircraft Payload (lbs) and Centre of Gravity");
-    xplane_data_lookup_table[63][1] = wmem_strbuf_new(wmem_epan_scope(), "Weight Empty");
-    xplane_data_lookup_table[63][2] = wmem_strbuf_new(wmem_epan_scope(), "Weight Total");
-    xplane_data_lookup_table[63][3] = wmem_strbuf_new(wmem_epan_scope(), "Fuel Total");
-    xplane_data_lookup_table[63][4] = wmem_strbuf_new(wmem_epan_scope(), "Weight Jettisonable");
-    xplane_data_lookup_table[63][5] = wmem_strbuf_new(wmem_epan_scope(), "Weight Current");
-    xplane_data_lookup_table[63][6] = wmem_strbuf_new(wmem_epan_scope(), "Weight Maximum");
-    xplane_data_lookup_table[63][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[63][8] = wmem_strbuf_new(wmem_epan_scope(), "CoG (feet behind reference point)");
-
-    xplane_data_lookup_table[64][0] = wmem_strbuf_new(wmem_epan_scope(), "Aerodynamic Forces");
-    xplane_data_lookup_table[64][1] = wmem_strbuf_new(wmem_epan_scope(), "Lift (lbs)");
-    xplane_data_lookup_table[64][2] = wmem_strbuf_new(wmem_epan_scope(), "Drag (lbs)");
-    xplane_data_lookup_table[64][3] = wmem_strbuf_new(wmem_epan_scope(), "Side (lbs)");
-    xplane_data_lookup_table[64][4] = wmem_strbuf_new(wmem_epan_scope(), "L (ft / lbs)");
-    xplane_data_lookup_table[64][5] = wmem_strbuf_new(wmem_epan_scope(), "M (ft / lbs)");
-    xplane_data_lookup_table[64][6] = wmem_strbuf_new(wmem_epan_scope(), "N (ft / lbs)");
-    xplane_data_lookup_table[64][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[64][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[65][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine Forces");
-    xplane_data_lookup_table[65][1] = wmem_strbuf_new(wmem_epan_scope(), "Normal (lbs)");
-    xplane_data_lookup_table[65][2] = wmem_strbuf_new(wmem_epan_scope(), "Axial (lbs)");
-    xplane_data_lookup_table[65][3] = wmem_strbuf_new(wmem_epan_scope(), "Side (lbs)");
-    xplane_data_lookup_table[65][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[65][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[65][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[65][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[65][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[66][0] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear Vertical Forces (lbs)");
-    xplane_data_lookup_table[66][1] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 1 (typically nosewheel)");
-    xplane_data_lookup_table[66][2] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 2");
-    xplane_data_lookup_table[66][3] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 3");
-    xplane_data_lookup_table[66][4] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 4");
-    xplane_data_lookup_table[66][5] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 5");
-    xplane_data_lookup_table[66][6] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 6");
-    xplane_data_lookup_table[66][7] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 7");
-    xplane_data_lookup_table[66][8] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 8");
-
-    xplane_data_lookup_table[67][0] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear Deployment Ratio (0=Up, 1=Down)");
-    xplane_data_lookup_table[67][1] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 1 (typically nosewheel)");
-    xplane_data_lookup_table[67][2] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 2");
-    xplane_data_lookup_table[67][3] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 3");
-    xplane_data_lookup_table[67][4] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 4");
-    xplane_data_lookup_table[67][5] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 5");
-    xplane_data_lookup_table[67][6] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 6");
-    xplane_data_lookup_table[67][7] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 7");
-    xplane_data_lookup_table[67][8] = wmem_strbuf_new(wmem_epan_scope(), "Landing Gear 8");
-
-    xplane_data_lookup_table[68][0] = wmem_strbuf_new(wmem_epan_scope(), "Lift over drag and coefficients");
-    xplane_data_lookup_table[68][1] = wmem_strbuf_new(wmem_epan_scope(), "Lift/Drag Ratio");
-    xplane_data_lookup_table[68][2] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[68][3] = wmem_strbuf_new(wmem_epan_scope(), "cl, total");
-    xplane_data_lookup_table[68][4] = wmem_strbuf_new(wmem_epan_scope(), "cd, total");
-    xplane_data_lookup_table[68][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[68][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[68][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[68][8] = wmem_strbuf_new(wmem_epan_scope(), "Lift/Drag (*etaP)");
-
-    xplane_data_lookup_table[69][0] = wmem_strbuf_new(wmem_epan_scope(), "Propeller Efficiency");
-    for (gint i = 1; i <= 8; i++)
-    {
-        xplane_data_lookup_table[69][i] = wmem_strbuf_new(wmem_epan_scope(), "");
-    }
-
-    xplane_data_lookup_table[70][0] = wmem_strbuf_new(wmem_epan_scope(), "Aileron deflections 1");
-    xplane_data_lookup_table[71][0] = wmem_strbuf_new(wmem_epan_scope(), "Aileron deflections 2");
-    xplane_data_lookup_table[72][0] = wmem_strbuf_new(wmem_epan_scope(), "Roll spoiler deflections 1");
-    xplane_data_lookup_table[73][0] = wmem_strbuf_new(wmem_epan_scope(), "Roll spoiler deflections 2");
-    xplane_data_lookup_table[74][0] = wmem_strbuf_new(wmem_epan_scope(), "Elevator Deflections (degrees)");
-    xplane_data_lookup_table[75][0] = wmem_strbuf_new(wmem_epan_scope(), "Rudder deflections");
-    xplane_data_lookup_table[76][0] = wmem_strbuf_new(wmem_epan_scope(), "Yaw and brake deflections");
-
-    for (guint i = 1; i <= 7; i += 2)
-    {
-        xplane_data_lookup_table[70][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Aileron");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[70][i], " %u", i / 2);
-        xplane_data_lookup_table[71][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Aileron");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[71][i], " %u", (i / 2) + 4);
-        xplane_data_lookup_table[72][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Roll spoiler ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[72][i], " %u", (i / 2));
-        xplane_data_lookup_table[73][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Roll spoiler ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[73][i], " %u", (i / 2) + 4);
-        xplane_data_lookup_table[74][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Elevator ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[74][i], " %u", (i / 2));
-        xplane_data_lookup_table[75][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Rudder ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[75][i], " %u", (i / 2));
-        xplane_data_lookup_table[76][i] = wmem_strbuf_new(wmem_epan_scope(), "Left Yaw Brake ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[76][i], " %u", (i / 2));
-    }
-    for (guint i = 2; i <= 8; i += 2)
-    {
-        xplane_data_lookup_table[70][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Aileron");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[70][i], " %u", i / 2);
-        xplane_data_lookup_table[71][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Aileron");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[71][i], " %u", (i / 2) + 4);
-        xplane_data_lookup_table[72][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Roll spoiler ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[72][i], " %u", (i / 2));
-        xplane_data_lookup_table[73][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Roll spoiler ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[73][i], " %u", (i / 2) + 4);
-        xplane_data_lookup_table[74][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Elevator ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[74][i], " %u", (i / 2));
-        xplane_data_lookup_table[75][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Rudder ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[75][i], " %u", (i / 2));
-        xplane_data_lookup_table[76][i] = wmem_strbuf_new(wmem_epan_scope(), "Right Yaw Brake ");
-        wmem_strbuf_append_printf(xplane_data_lookup_table[76][i], " %u", (i / 2));
-    }
-    xplane_data_lookup_table[77][0] = wmem_strbuf_new(wmem_epan_scope(), "Control Forces on Pilot's Hands (lbs)");
-    xplane_data_lookup_table[77][1] = wmem_strbuf_new(wmem_epan_scope(), "Pitch");
-    xplane_data_lookup_table[77][2] = wmem_strbuf_new(wmem_epan_scope(), "Roll");
-    xplane_data_lookup_table[77][3] = wmem_strbuf_new(wmem_epan_scope(), "Heading");
-    xplane_data_lookup_table[77][4] = wmem_strbuf_new(wmem_epan_scope(), "Left-Brake");
-    xplane_data_lookup_table[77][5] = wmem_strbuf_new(wmem_epan_scope(), "Right-Brake");
-    xplane_data_lookup_table[77][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[77][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[77][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[78][0] = wmem_strbuf_new(wmem_epan_scope(), "Total Vertical Thrust Vectors");
-    xplane_data_lookup_table[79][0] = wmem_strbuf_new(wmem_epan_scope(), "Total lateral thrust vectors");
-    xplane_data_lookup_table[80][0] = wmem_strbuf_new(wmem_epan_scope(), "Pitch cyclic disc tilts");
-    xplane_data_lookup_table[81][0] = wmem_strbuf_new(wmem_epan_scope(), "Roll cyclic disc tilts");
-    xplane_data_lookup_table[82][0] = wmem_strbuf_new(wmem_epan_scope(), "Pitch cyclic flapping");
-    xplane_data_lookup_table[83][0] = wmem_strbuf_new(wmem_epan_scope(), "Roll cyclic flapping");
-    for (guint i = 1; i <= 8; i++)
-    {
-        xplane_data_lookup_table[78][i] = wmem_strbuf_new(wmem_epan_scope(), "Vertical Thrust Vectors ");
-        xplane_data_lookup_table[79][i] = wmem_strbuf_new(wmem_epan_scope(), "Lateral thrust vectors ");
-        xplane_data_lookup_table[80][i] = wmem_strbuf_new(wmem_epan_scope(), "Pitch cyclic disc tilts ");
-        xplane_data_lookup_table[81][i] = wmem_strbuf_new(wmem_epan_scope(), "Roll cyclic disc tilts ");
-        xplane_data_lookup_table[82][i] = wmem_strbuf_new(wmem_epan_scope(), "Pitch cyclic flapping ");
-        xplane_data_lookup_table[83][i] = wmem_strbuf_new(wmem_epan_scope(), "Roll cyclic flapping ");
-    }
-
-    xplane_data_lookup_table[84][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect lift (wings)");
-    xplane_data_lookup_table[84][1] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 L cl*");
-    xplane_data_lookup_table[84][2] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 R cl*");
-    xplane_data_lookup_table[84][3] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 L cl*");
-    xplane_data_lookup_table[84][4] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 R cl*");
-    xplane_data_lookup_table[84][5] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 L cl*");
-    xplane_data_lookup_table[84][6] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 R cl*");
-    xplane_data_lookup_table[84][7] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 L cl*");
-    xplane_data_lookup_table[84][8] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 R cl*");
-
-    xplane_data_lookup_table[85][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect drag (wings)");
-    xplane_data_lookup_table[85][1] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 Lcdi*");
-    xplane_data_lookup_table[85][2] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 Rcdi*");
-    xplane_data_lookup_table[85][3] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 Lcdi*");
-    xplane_data_lookup_table[85][4] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 Rcdi*");
-    xplane_data_lookup_table[85][5] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 Lcdi*");
-    xplane_data_lookup_table[85][6] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 Rcdi*");
-    xplane_data_lookup_table[85][7] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 Lcdi*");
-    xplane_data_lookup_table[85][8] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 Rcdi*");
-
-    xplane_data_lookup_table[86][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect wash (wings)");
-    xplane_data_lookup_table[86][1] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 wash*");
-    xplane_data_lookup_table[86][2] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 wash*");
-    xplane_data_lookup_table[86][3] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 wash*");
-    xplane_data_lookup_table[86][4] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 wash*");
-    xplane_data_lookup_table[86][5] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 wash*");
-    xplane_data_lookup_table[86][6] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 wash*");
-    xplane_data_lookup_table[86][7] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 wash*");
-    xplane_data_lookup_table[86][8] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 wash*");
-
-    xplane_data_lookup_table[87][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect lift (stabilisers)");
-    xplane_data_lookup_table[87][1] = wmem_strbuf_new(wmem_epan_scope(), "hstab L cl*");
-    xplane_data_lookup_table[87][2] = wmem_strbuf_new(wmem_epan_scope(), "hstab R cl*");
-    xplane_data_lookup_table[87][3] = wmem_strbuf_new(wmem_epan_scope(), "vstb1 cl*");
-    xplane_data_lookup_table[87][4] = wmem_strbuf_new(wmem_epan_scope(), "vstb2 cl*");
-    xplane_data_lookup_table[87][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[87][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[87][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[87][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[88][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect drag (stabilisers)");
-    xplane_data_lookup_table[88][1] = wmem_strbuf_new(wmem_epan_scope(), "hstab Lcdi*");
-    xplane_data_lookup_table[88][2] = wmem_strbuf_new(wmem_epan_scope(), "hstab Rcdi*");
-    xplane_data_lookup_table[88][3] = wmem_strbuf_new(wmem_epan_scope(), "vstb1 cdi*");
-    xplane_data_lookup_table[88][4] = wmem_strbuf_new(wmem_epan_scope(), "vstb2 cdi*");
-    xplane_data_lookup_table[88][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[88][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[88][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[88][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[89][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground Effect wash (stabilisers)");
-    xplane_data_lookup_table[89][1] = wmem_strbuf_new(wmem_epan_scope(), "hstab wash*");
-    xplane_data_lookup_table[89][2] = wmem_strbuf_new(wmem_epan_scope(), "hstab wash*");
-    xplane_data_lookup_table[89][3] = wmem_strbuf_new(wmem_epan_scope(), "vstb1 wash*");
-    xplane_data_lookup_table[89][4] = wmem_strbuf_new(wmem_epan_scope(), "vstb2 wash*");
-    xplane_data_lookup_table[89][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[89][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[89][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[89][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[90][0] = wmem_strbuf_new(wmem_epan_scope(), "Wash ratio from Ground Effect (rotors)");
-    xplane_data_lookup_table[90][1] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 1 wash*");
-    xplane_data_lookup_table[90][2] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 2 wash*");
-    xplane_data_lookup_table[90][3] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 3 wash*");
-    xplane_data_lookup_table[90][4] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 4 wash*");
-    xplane_data_lookup_table[90][5] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 5 wash*");
-    xplane_data_lookup_table[90][6] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 6 wash*");
-    xplane_data_lookup_table[90][7] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 7 wash*");
-    xplane_data_lookup_table[90][8] = wmem_strbuf_new(wmem_epan_scope(), "GE rotor 8 wash*");
-
-    xplane_data_lookup_table[91][0] = wmem_strbuf_new(wmem_epan_scope(), "Wash ratio from Vortex Effect (rotors)");
-    xplane_data_lookup_table[91][1] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 1 wash*");
-    xplane_data_lookup_table[91][2] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 2 wash*");
-    xplane_data_lookup_table[91][3] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 3 wash*");
-    xplane_data_lookup_table[91][4] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 4 wash*");
-    xplane_data_lookup_table[91][5] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 5 wash*");
-    xplane_data_lookup_table[91][6] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 6 wash*");
-    xplane_data_lookup_table[91][7] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 7 wash*");
-    xplane_data_lookup_table[91][8] = wmem_strbuf_new(wmem_epan_scope(), "VRS rotor 8 wash*");
-
-    xplane_data_lookup_table[92][0] = wmem_strbuf_new(wmem_epan_scope(), "Wing lift");
-    xplane_data_lookup_table[92][1] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 lift");
-    xplane_data_lookup_table[92][2] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 lift");
-    xplane_data_lookup_table[92][3] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 lift");
-    xplane_data_lookup_table[92][4] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 lift");
-    xplane_data_lookup_table[92][5] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 lift");
-    xplane_data_lookup_table[92][6] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 lift");
-    xplane_data_lookup_table[92][7] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 lift");
-    xplane_data_lookup_table[92][8] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 lift");
-
-    xplane_data_lookup_table[93][0] = wmem_strbuf_new(wmem_epan_scope(), "Wing drag");
-    xplane_data_lookup_table[93][1] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 drag");
-    xplane_data_lookup_table[93][2] = wmem_strbuf_new(wmem_epan_scope(), "Wing1 drag");
-    xplane_data_lookup_table[93][3] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 drag");
-    xplane_data_lookup_table[93][4] = wmem_strbuf_new(wmem_epan_scope(), "Wing2 drag");
-    xplane_data_lookup_table[93][5] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 drag");
-    xplane_data_lookup_table[93][6] = wmem_strbuf_new(wmem_epan_scope(), "Wing3 drag");
-    xplane_data_lookup_table[93][7] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 drag");
-    xplane_data_lookup_table[93][8] = wmem_strbuf_new(wmem_epan_scope(), "Wing4 drag");
-
-    xplane_data_lookup_table[94][0] = wmem_strbuf_new(wmem_epan_scope(), "Stabilizer lift");
-    xplane_data_lookup_table[94][1] = wmem_strbuf_new(wmem_epan_scope(), "hstab lift");
-    xplane_data_lookup_table[94][2] = wmem_strbuf_new(wmem_epan_scope(), "hstab lift");
-    xplane_data_lookup_table[94][3] = wmem_strbuf_new(wmem_epan_scope(), "vstb1 lift");
-    xplane_data_lookup_table[94][4] = wmem_strbuf_new(wmem_epan_scope(), "vstb2 lift");
-    xplane_data_lookup_table[94][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[94][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[94][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[94][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[95][0] = wmem_strbuf_new(wmem_epan_scope(), "Stabilizer drag");
-    xplane_data_lookup_table[95][1] = wmem_strbuf_new(wmem_epan_scope(), "hstab drag");
-    xplane_data_lookup_table[95][2] = wmem_strbuf_new(wmem_epan_scope(), "hstab drag");
-    xplane_data_lookup_table[95][3] = wmem_strbuf_new(wmem_epan_scope(), "vstb1 drag");
-    xplane_data_lookup_table[95][4] = wmem_strbuf_new(wmem_epan_scope(), "vstb2 drag");
-    xplane_data_lookup_table[95][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[95][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[95][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[95][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[96][0] = wmem_strbuf_new(wmem_epan_scope(), "COM1 and COM2 radio freqs");
-    xplane_data_lookup_table[96][1] = wmem_strbuf_new(wmem_epan_scope(), "COM1 Active");
-    xplane_data_lookup_table[96][2] = wmem_strbuf_new(wmem_epan_scope(), "COM1 Standby");
-    xplane_data_lookup_table[96][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[96][4] = wmem_strbuf_new(wmem_epan_scope(), "COM2 Active");
-    xplane_data_lookup_table[96][5] = wmem_strbuf_new(wmem_epan_scope(), "COM2 Standby");
-    xplane_data_lookup_table[96][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[96][7] = wmem_strbuf_new(wmem_epan_scope(), "Transmit Status");
-    xplane_data_lookup_table[96][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[97][0] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 and NAV2 radio freqs");
-    xplane_data_lookup_table[97][1] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 Active");
-    xplane_data_lookup_table[97][2] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 Standby");
-    xplane_data_lookup_table[97][3] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 Type");
-    xplane_data_lookup_table[97][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[97][5] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 Active");
-    xplane_data_lookup_table[97][6] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 Standby");
-    xplane_data_lookup_table[97][7] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 Type");
-    xplane_data_lookup_table[97][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[98][0] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 and NAV2 OBS");
-    xplane_data_lookup_table[98][1] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 OBS");
-    xplane_data_lookup_table[98][2] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 s-crs");
-    xplane_data_lookup_table[98][3] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 flag");
-    xplane_data_lookup_table[98][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[98][5] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 OBS");
-    xplane_data_lookup_table[98][6] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 s-crs");
-    xplane_data_lookup_table[98][7] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 flag");
-    xplane_data_lookup_table[98][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[99][0] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 deflection");
-    xplane_data_lookup_table[99][1] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 n-typ");
-    xplane_data_lookup_table[99][2] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 to-fr");
-    xplane_data_lookup_table[99][3] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 m-crs");
-    xplane_data_lookup_table[99][4] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 r-brg");
-    xplane_data_lookup_table[99][5] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 dme-d");
-    xplane_data_lookup_table[99][6] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 h-def");
-    xplane_data_lookup_table[99][7] = wmem_strbuf_new(wmem_epan_scope(), "NAV1 v-def");
-    xplane_data_lookup_table[99][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[100][0] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 deflection");
-    xplane_data_lookup_table[100][1] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 n-typ");
-    xplane_data_lookup_table[100][2] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 to-fr");
-    xplane_data_lookup_table[100][3] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 m-crs");
-    xplane_data_lookup_table[100][4] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 r-brg");
-    xplane_data_lookup_table[100][5] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 dme-d");
-    xplane_data_lookup_table[100][6] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 h-def");
-    xplane_data_lookup_table[100][7] = wmem_strbuf_new(wmem_epan_scope(), "NAV2 v-def");
-    xplane_data_lookup_table[100][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[101][0] = wmem_strbuf_new(wmem_epan_scope(), "ADF1 and ADF2 statuses");
-    xplane_data_lookup_table[101][1] = wmem_strbuf_new(wmem_epan_scope(), "ACF1 frequency");
-    xplane_data_lookup_table[101][2] = wmem_strbuf_new(wmem_epan_scope(), "ADF1 card");
-    xplane_data_lookup_table[101][3] = wmem_strbuf_new(wmem_epan_scope(), "ADF1 r-brg");
-    xplane_data_lookup_table[101][4] = wmem_strbuf_new(wmem_epan_scope(), "ADF1 n-typ");
-    xplane_data_lookup_table[101][5] = wmem_strbuf_new(wmem_epan_scope(), "ACF2 frequency");
-    xplane_data_lookup_table[101][6] = wmem_strbuf_new(wmem_epan_scope(), "ADF2 card");
-    xplane_data_lookup_table[101][7] = wmem_strbuf_new(wmem_epan_scope(), "ADF2 r-brg");
-    xplane_data_lookup_table[101][8] = wmem_strbuf_new(wmem_epan_scope(), "ADF2 n-typ");
-
-    xplane_data_lookup_table[102][0] = wmem_strbuf_new(wmem_epan_scope(), "DME status");
-    xplane_data_lookup_table[102][1] = wmem_strbuf_new(wmem_epan_scope(), "DME nav01");
-    xplane_data_lookup_table[102][2] = wmem_strbuf_new(wmem_epan_scope(), "DME mode");
-    xplane_data_lookup_table[102][3] = wmem_strbuf_new(wmem_epan_scope(), "DME found");
-    xplane_data_lookup_table[102][4] = wmem_strbuf_new(wmem_epan_scope(), "DME dist");
-    xplane_data_lookup_table[102][5] = wmem_strbuf_new(wmem_epan_scope(), "DME speed");
-    xplane_data_lookup_table[102][6] = wmem_strbuf_new(wmem_epan_scope(), "DME time");
-    xplane_data_lookup_table[102][7] = wmem_strbuf_new(wmem_epan_scope(), "DME n-typ");
-    xplane_data_lookup_table[102][8] = wmem_strbuf_new(wmem_epan_scope(), "DME-3 freq");
-
-    xplane_data_lookup_table[103][0] = wmem_strbuf_new(wmem_epan_scope(), "GPS status");
-    xplane_data_lookup_table[103][1] = wmem_strbuf_new(wmem_epan_scope(), "GPS mode");
-    xplane_data_lookup_table[103][2] = wmem_strbuf_new(wmem_epan_scope(), "GPS index");
-    xplane_data_lookup_table[103][3] = wmem_strbuf_new(wmem_epan_scope(), "GPS dist - nm");
-    xplane_data_lookup_table[103][4] = wmem_strbuf_new(wmem_epan_scope(), "OSB mag");
-    xplane_data_lookup_table[103][5] = wmem_strbuf_new(wmem_epan_scope(), "crs mag");
-    xplane_data_lookup_table[103][6] = wmem_strbuf_new(wmem_epan_scope(), "rel brng");
-    xplane_data_lookup_table[103][7] = wmem_strbuf_new(wmem_epan_scope(), "hdef dots");
-    xplane_data_lookup_table[103][8] = wmem_strbuf_new(wmem_epan_scope(), "vdef dots");
-
-    xplane_data_lookup_table[104][0] = wmem_strbuf_new(wmem_epan_scope(), "Transponder status");
-    xplane_data_lookup_table[104][1] = wmem_strbuf_new(wmem_epan_scope(), "trans mode");
-    xplane_data_lookup_table[104][2] = wmem_strbuf_new(wmem_epan_scope(), "trans sett");
-    xplane_data_lookup_table[104][3] = wmem_strbuf_new(wmem_epan_scope(), "trans ID");
-    xplane_data_lookup_table[104][4] = wmem_strbuf_new(wmem_epan_scope(), "trans inter");
-    xplane_data_lookup_table[104][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[104][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[104][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[104][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[105][0] = wmem_strbuf_new(wmem_epan_scope(), "Marker staus");
-    xplane_data_lookup_table[105][1] = wmem_strbuf_new(wmem_epan_scope(), "Outer Marker - morse");
-    xplane_data_lookup_table[105][2] = wmem_strbuf_new(wmem_epan_scope(), "Middle Marker - morse");
-    xplane_data_lookup_table[105][3] = wmem_strbuf_new(wmem_epan_scope(), "Inner Marker - morse");
-    xplane_data_lookup_table[105][4] = wmem_strbuf_new(wmem_epan_scope(), "audio - active");
-    xplane_data_lookup_table[105][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[105][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[105][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[105][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[106][0] = wmem_strbuf_new(wmem_epan_scope(), "Electrical switches");
-    xplane_data_lookup_table[106][1] = wmem_strbuf_new(wmem_epan_scope(), "avio 0/1");
-    xplane_data_lookup_table[106][2] = wmem_strbuf_new(wmem_epan_scope(), "Navigation Lights (0/1)");
-    xplane_data_lookup_table[106][3] = wmem_strbuf_new(wmem_epan_scope(), "Beacon Light (0/1)");
-    xplane_data_lookup_table[106][4] = wmem_strbuf_new(wmem_epan_scope(), "Strob Light (0/1)");
-    xplane_data_lookup_table[106][5] = wmem_strbuf_new(wmem_epan_scope(), "Landing Lights (0/1)");
-    xplane_data_lookup_table[106][6] = wmem_strbuf_new(wmem_epan_scope(), "Taxi Lights (0/1)");
-    xplane_data_lookup_table[106][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[106][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[107][0] = wmem_strbuf_new(wmem_epan_scope(), "EFIS switches");
-    xplane_data_lookup_table[107][1] = wmem_strbuf_new(wmem_epan_scope(), "ECAM mode`");
-    xplane_data_lookup_table[107][2] = wmem_strbuf_new(wmem_epan_scope(), "EFIS sel 1");
-    xplane_data_lookup_table[107][3] = wmem_strbuf_new(wmem_epan_scope(), "EFIS sel 2");
-    xplane_data_lookup_table[107][4] = wmem_strbuf_new(wmem_epan_scope(), "HSI sel 1");
-    xplane_data_lookup_table[107][5] = wmem_strbuf_new(wmem_epan_scope(), "HSI sel 2");
-    xplane_data_lookup_table[107][6] = wmem_strbuf_new(wmem_epan_scope(), "HSI arc");
-    xplane_data_lookup_table[107][7] = wmem_strbuf_new(wmem_epan_scope(), "map r-sel");
-    xplane_data_lookup_table[107][8] = wmem_strbuf_new(wmem_epan_scope(), "map range");
-
-    xplane_data_lookup_table[108][0] = wmem_strbuf_new(wmem_epan_scope(), "AP, FD, HUD switches");
-    xplane_data_lookup_table[108][1] = wmem_strbuf_new(wmem_epan_scope(), "Ap - src");
-    xplane_data_lookup_table[108][2] = wmem_strbuf_new(wmem_epan_scope(), "fdir - mode");
-    xplane_data_lookup_table[108][3] = wmem_strbuf_new(wmem_epan_scope(), "fdir - ptch");
-    xplane_data_lookup_table[108][4] = wmem_strbuf_new(wmem_epan_scope(), "fdir - roll");
-    xplane_data_lookup_table[108][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[108][6] = wmem_strbuf_new(wmem_epan_scope(), "HUD power");
-    xplane_data_lookup_table[108][7] = wmem_strbuf_new(wmem_epan_scope(), "HUD brite");
-    xplane_data_lookup_table[108][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[109][0] = wmem_strbuf_new(wmem_epan_scope(), "Anti-ice switches");
-    xplane_data_lookup_table[109][1] = wmem_strbuf_new(wmem_epan_scope(), "deice - all");
-    xplane_data_lookup_table[109][2] = wmem_strbuf_new(wmem_epan_scope(), "deice inlet");
-    xplane_data_lookup_table[109][3] = wmem_strbuf_new(wmem_epan_scope(), "deice prop");
-    xplane_data_lookup_table[109][4] = wmem_strbuf_new(wmem_epan_scope(), "deice windo");
-    xplane_data_lookup_table[109][5] = wmem_strbuf_new(wmem_epan_scope(), "deice pito1");
-    xplane_data_lookup_table[109][6] = wmem_strbuf_new(wmem_epan_scope(), "deice piot2");
-    xplane_data_lookup_table[109][7] = wmem_strbuf_new(wmem_epan_scope(), "deice AoA");
-    xplane_data_lookup_table[109][8] = wmem_strbuf_new(wmem_epan_scope(), "devie wing");
-
-    xplane_data_lookup_table[110][0] = wmem_strbuf_new(wmem_epan_scope(), "Anti-ice and fuel switches");
-    xplane_data_lookup_table[110][1] = wmem_strbuf_new(wmem_epan_scope(), "alt air0");
-    xplane_data_lookup_table[110][2] = wmem_strbuf_new(wmem_epan_scope(), "alt air1");
-    xplane_data_lookup_table[110][3] = wmem_strbuf_new(wmem_epan_scope(), "auto ignit");
-    xplane_data_lookup_table[110][4] = wmem_strbuf_new(wmem_epan_scope(), "audo ignit");
-    xplane_data_lookup_table[110][5] = wmem_strbuf_new(wmem_epan_scope(), "manul ignit");
-    xplane_data_lookup_table[110][6] = wmem_strbuf_new(wmem_epan_scope(), "manul ignit");
-    xplane_data_lookup_table[110][7] = wmem_strbuf_new(wmem_epan_scope(), "l-eng tank");
-    xplane_data_lookup_table[110][8] = wmem_strbuf_new(wmem_epan_scope(), "r-eng tank");
-
-    xplane_data_lookup_table[111][0] = wmem_strbuf_new(wmem_epan_scope(), "Clutch and artificial stability switches");
-    xplane_data_lookup_table[111][1] = wmem_strbuf_new(wmem_epan_scope(), "prero engag");
-    xplane_data_lookup_table[111][2] = wmem_strbuf_new(wmem_epan_scope(), "prero level");
-    xplane_data_lookup_table[111][3] = wmem_strbuf_new(wmem_epan_scope(), "clutc ratio");
-    xplane_data_lookup_table[111][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[111][5] = wmem_strbuf_new(wmem_epan_scope(), "art pitch");
-    xplane_data_lookup_table[111][6] = wmem_strbuf_new(wmem_epan_scope(), "art roll");
-    xplane_data_lookup_table[111][7] = wmem_strbuf_new(wmem_epan_scope(), "yaw damp");
-    xplane_data_lookup_table[111][8] = wmem_strbuf_new(wmem_epan_scope(), "auto brake");
-
-    xplane_data_lookup_table[112][0] = wmem_strbuf_new(wmem_epan_scope(), "Misc switches");
-    xplane_data_lookup_table[112][1] = wmem_strbuf_new(wmem_epan_scope(), "tot energ");
-    xplane_data_lookup_table[112][2] = wmem_strbuf_new(wmem_epan_scope(), "radal feet");
-    xplane_data_lookup_table[112][3] = wmem_strbuf_new(wmem_epan_scope(), "prop sync");
-    xplane_data_lookup_table[112][4] = wmem_strbuf_new(wmem_epan_scope(), "fethr mode");
-    xplane_data_lookup_table[112][5] = wmem_strbuf_new(wmem_epan_scope(), "puffr power");
-    xplane_data_lookup_table[112][6] = wmem_strbuf_new(wmem_epan_scope(), "water scoop");
-    xplane_data_lookup_table[112][7] = wmem_strbuf_new(wmem_epan_scope(), "arrst hook");
-    xplane_data_lookup_table[112][8] = wmem_strbuf_new(wmem_epan_scope(), "chute deply");
-
-    xplane_data_lookup_table[113][0] = wmem_strbuf_new(wmem_epan_scope(), "Gen. Annunciations 1");
-    xplane_data_lookup_table[113][1] = wmem_strbuf_new(wmem_epan_scope(), "mast cau");
-    xplane_data_lookup_table[113][2] = wmem_strbuf_new(wmem_epan_scope(), "mast wat");
-    xplane_data_lookup_table[113][3] = wmem_strbuf_new(wmem_epan_scope(), "masy accp");
-    xplane_data_lookup_table[113][4] = wmem_strbuf_new(wmem_epan_scope(), "auto disco");
-    xplane_data_lookup_table[113][5] = wmem_strbuf_new(wmem_epan_scope(), "low vacum");
-    xplane_data_lookup_table[113][6] = wmem_strbuf_new(wmem_epan_scope(), "low volt");
-    xplane_data_lookup_table[113][7] = wmem_strbuf_new(wmem_epan_scope(), "fuel quant");
-    xplane_data_lookup_table[113][8] = wmem_strbuf_new(wmem_epan_scope(), "hyd press");
-
-    xplane_data_lookup_table[114][0] = wmem_strbuf_new(wmem_epan_scope(), "Gen. Annunciations 2");
-    xplane_data_lookup_table[114][1] = wmem_strbuf_new(wmem_epan_scope(), "yawda on");
-    xplane_data_lookup_table[114][2] = wmem_strbuf_new(wmem_epan_scope(), "sbrk on");
-    xplane_data_lookup_table[114][3] = wmem_strbuf_new(wmem_epan_scope(), "GPWS warn");
-    xplane_data_lookup_table[114][4] = wmem_strbuf_new(wmem_epan_scope(), "ice warn");
-    xplane_data_lookup_table[114][5] = wmem_strbuf_new(wmem_epan_scope(), "pitot off");
-    xplane_data_lookup_table[114][6] = wmem_strbuf_new(wmem_epan_scope(), "cabin althi");
-    xplane_data_lookup_table[114][7] = wmem_strbuf_new(wmem_epan_scope(), "afthr arm");
-    xplane_data_lookup_table[114][8] = wmem_strbuf_new(wmem_epan_scope(), "osps time");
-
-    xplane_data_lookup_table[115][0] = wmem_strbuf_new(wmem_epan_scope(), "Engine annunciations");
-    xplane_data_lookup_table[115][1] = wmem_strbuf_new(wmem_epan_scope(), "fuel press");
-    xplane_data_lookup_table[115][2] = wmem_strbuf_new(wmem_epan_scope(), "oil press");
-    xplane_data_lookup_table[115][3] = wmem_strbuf_new(wmem_epan_scope(), "oil temp");
-    xplane_data_lookup_table[115][4] = wmem_strbuf_new(wmem_epan_scope(), "inver warn");
-    xplane_data_lookup_table[115][5] = wmem_strbuf_new(wmem_epan_scope(), "gener warn");
-    xplane_data_lookup_table[115][6] = wmem_strbuf_new(wmem_epan_scope(), "chip detec");
-    xplane_data_lookup_table[115][7] = wmem_strbuf_new(wmem_epan_scope(), "engin fire");
-    xplane_data_lookup_table[115][8] = wmem_strbuf_new(wmem_epan_scope(), "ignit 0/1");
-
-    xplane_data_lookup_table[116][0] = wmem_strbuf_new(wmem_epan_scope(), "Autopilot armed status");
-    xplane_data_lookup_table[116][1] = wmem_strbuf_new(wmem_epan_scope(), "nav arm");
-    xplane_data_lookup_table[116][2] = wmem_strbuf_new(wmem_epan_scope(), "alt arm");
-    xplane_data_lookup_table[116][3] = wmem_strbuf_new(wmem_epan_scope(), "app arm");
-    xplane_data_lookup_table[116][4] = wmem_strbuf_new(wmem_epan_scope(), "vnav enab");
-    xplane_data_lookup_table[116][5] = wmem_strbuf_new(wmem_epan_scope(), "vnav warn");
-    xplane_data_lookup_table[116][6] = wmem_strbuf_new(wmem_epan_scope(), "vnav time");
-    xplane_data_lookup_table[116][7] = wmem_strbuf_new(wmem_epan_scope(), "gp enabl");
-    xplane_data_lookup_table[116][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[117][0] = wmem_strbuf_new(wmem_epan_scope(), "Autopilot modes");
-    xplane_data_lookup_table[117][1] = wmem_strbuf_new(wmem_epan_scope(), "auto throt");
-    xplane_data_lookup_table[117][2] = wmem_strbuf_new(wmem_epan_scope(), "mode hding");
-    xplane_data_lookup_table[117][3] = wmem_strbuf_new(wmem_epan_scope(), "mode alt");
-    xplane_data_lookup_table[117][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[117][5] = wmem_strbuf_new(wmem_epan_scope(), "bac 0/1");
-    xplane_data_lookup_table[117][6] = wmem_strbuf_new(wmem_epan_scope(), "app");
-    xplane_data_lookup_table[117][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[117][8] = wmem_strbuf_new(wmem_epan_scope(), "sync butn");
-
-    xplane_data_lookup_table[118][0] = wmem_strbuf_new(wmem_epan_scope(), "Autopilot values");
-    xplane_data_lookup_table[118][1] = wmem_strbuf_new(wmem_epan_scope(), "set speed");
-    xplane_data_lookup_table[118][2] = wmem_strbuf_new(wmem_epan_scope(), "set hding");
-    xplane_data_lookup_table[118][3] = wmem_strbuf_new(wmem_epan_scope(), "set vvi");
-    xplane_data_lookup_table[118][4] = wmem_strbuf_new(wmem_epan_scope(), "dial alt");
-    xplane_data_lookup_table[118][5] = wmem_strbuf_new(wmem_epan_scope(), "bac vnav alt");
-    xplane_data_lookup_table[118][6] = wmem_strbuf_new(wmem_epan_scope(), "use alt");
-    xplane_data_lookup_table[118][7] = wmem_strbuf_new(wmem_epan_scope(), "sync roll");
-    xplane_data_lookup_table[118][8] = wmem_strbuf_new(wmem_epan_scope(), "sync pitch");
-
-    xplane_data_lookup_table[119][0] = wmem_strbuf_new(wmem_epan_scope(), "Weapon status");
-    xplane_data_lookup_table[119][1] = wmem_strbuf_new(wmem_epan_scope(), "hdng delta");
-    xplane_data_lookup_table[119][2] = wmem_strbuf_new(wmem_epan_scope(), "ptch delta");
-    xplane_data_lookup_table[119][3] = wmem_strbuf_new(wmem_epan_scope(), "R d/sec");
-    xplane_data_lookup_table[119][4] = wmem_strbuf_new(wmem_epan_scope(), "Q d/sec");
-    xplane_data_lookup_table[119][5] = wmem_strbuf_new(wmem_epan_scope(), "rudd ratio");
-    xplane_data_lookup_table[119][6] = wmem_strbuf_new(wmem_epan_scope(), "elev ratio");
-    xplane_data_lookup_table[119][7] = wmem_strbuf_new(wmem_epan_scope(), "V kts");
-    xplane_data_lookup_table[119][8] = wmem_strbuf_new(wmem_epan_scope(), "dis ft");
-
-    xplane_data_lookup_table[120][0] = wmem_strbuf_new(wmem_epan_scope(), "Pressurization status");
-    xplane_data_lookup_table[120][1] = wmem_strbuf_new(wmem_epan_scope(), "set alt");
-    xplane_data_lookup_table[120][2] = wmem_strbuf_new(wmem_epan_scope(), "set vvi");
-    xplane_data_lookup_table[120][3] = wmem_strbuf_new(wmem_epan_scope(), "cabin alt");
-    xplane_data_lookup_table[120][4] = wmem_strbuf_new(wmem_epan_scope(), "cabin vvi");
-    xplane_data_lookup_table[120][5] = wmem_strbuf_new(wmem_epan_scope(), "test time");
-    xplane_data_lookup_table[120][6] = wmem_strbuf_new(wmem_epan_scope(), "diff psi");
-    xplane_data_lookup_table[120][7] = wmem_strbuf_new(wmem_epan_scope(), "dump all");
-    xplane_data_lookup_table[120][8] = wmem_strbuf_new(wmem_epan_scope(), "bleed src");
-
-    xplane_data_lookup_table[121][0] = wmem_strbuf_new(wmem_epan_scope(), "APU and GPU status");
-    xplane_data_lookup_table[121][1] = wmem_strbuf_new(wmem_epan_scope(), "APU runng");
-    xplane_data_lookup_table[121][2] = wmem_strbuf_new(wmem_epan_scope(), "APU N1");
-    xplane_data_lookup_table[121][3] = wmem_strbuf_new(wmem_epan_scope(), "APU rat");
-    xplane_data_lookup_table[121][4] = wmem_strbuf_new(wmem_epan_scope(), "GPU rat");
-    xplane_data_lookup_table[121][5] = wmem_strbuf_new(wmem_epan_scope(), "RAT rat");
-    xplane_data_lookup_table[121][6] = wmem_strbuf_new(wmem_epan_scope(), "APU amp");
-    xplane_data_lookup_table[121][7] = wmem_strbuf_new(wmem_epan_scope(), "GPU amp");
-    xplane_data_lookup_table[121][8] = wmem_strbuf_new(wmem_epan_scope(), "RAT amp");
-
-    xplane_data_lookup_table[122][0] = wmem_strbuf_new(wmem_epan_scope(), "Radar status");
-    xplane_data_lookup_table[122][1] = wmem_strbuf_new(wmem_epan_scope(), "targ select");
-    xplane_data_lookup_table[122][2] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[122][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[123][0] = wmem_strbuf_new(wmem_epan_scope(), "Hydraulic status");
-    xplane_data_lookup_table[123][1] = wmem_strbuf_new(wmem_epan_scope(), "eng-1 pump");
-    xplane_data_lookup_table[123][2] = wmem_strbuf_new(wmem_epan_scope(), "eng-2 pump");
-    xplane_data_lookup_table[123][3] = wmem_strbuf_new(wmem_epan_scope(), "ele pum");
-    xplane_data_lookup_table[123][4] = wmem_strbuf_new(wmem_epan_scope(), "RA pum");
-    xplane_data_lookup_table[123][5] = wmem_strbuf_new(wmem_epan_scope(), "hyd qty");
-    xplane_data_lookup_table[123][6] = wmem_strbuf_new(wmem_epan_scope(), "hyd qty");
-    xplane_data_lookup_table[123][7] = wmem_strbuf_new(wmem_epan_scope(), "hyd pres");
-    xplane_data_lookup_table[123][8] = wmem_strbuf_new(wmem_epan_scope(), "hyd pres");
-
-    xplane_data_lookup_table[124][0] = wmem_strbuf_new(wmem_epan_scope(), "Electrical and solar systems");
-    xplane_data_lookup_table[124][1] = wmem_strbuf_new(wmem_epan_scope(), "bus1 volt");
-    xplane_data_lookup_table[124][2] = wmem_strbuf_new(wmem_epan_scope(), "bus2 volt");
-    xplane_data_lookup_table[124][3] = wmem_strbuf_new(wmem_epan_scope(), "bus1 amp");
-    xplane_data_lookup_table[124][4] = wmem_strbuf_new(wmem_epan_scope(), "bus2 amp");
-    xplane_data_lookup_table[124][5] = wmem_strbuf_new(wmem_epan_scope(), "batt1 w-hr");
-    xplane_data_lookup_table[124][6] = wmem_strbuf_new(wmem_epan_scope(), "batt2 w-hr");
-    xplane_data_lookup_table[124][7] = wmem_strbuf_new(wmem_epan_scope(), "engin in W");
-    xplane_data_lookup_table[124][8] = wmem_strbuf_new(wmem_epan_scope(), "solar out W");
-
-    xplane_data_lookup_table[125][0] = wmem_strbuf_new(wmem_epan_scope(), "Icing status 1");
-    xplane_data_lookup_table[125][1] = wmem_strbuf_new(wmem_epan_scope(), "inlet ice");
-    xplane_data_lookup_table[125][2] = wmem_strbuf_new(wmem_epan_scope(), "inlet ine");
-    xplane_data_lookup_table[125][3] = wmem_strbuf_new(wmem_epan_scope(), "prop ice");
-    xplane_data_lookup_table[125][4] = wmem_strbuf_new(wmem_epan_scope(), "prop ice");
-    xplane_data_lookup_table[125][5] = wmem_strbuf_new(wmem_epan_scope(), "pitot ice");
-    xplane_data_lookup_table[125][6] = wmem_strbuf_new(wmem_epan_scope(), "pitot ice");
-    xplane_data_lookup_table[125][7] = wmem_strbuf_new(wmem_epan_scope(), "statc ice");
-    xplane_data_lookup_table[125][8] = wmem_strbuf_new(wmem_epan_scope(), "statc ice");
-
-    xplane_data_lookup_table[126][0] = wmem_strbuf_new(wmem_epan_scope(), "Icing status 2");
-    xplane_data_lookup_table[126][1] = wmem_strbuf_new(wmem_epan_scope(), "aoa ice");
-    xplane_data_lookup_table[126][2] = wmem_strbuf_new(wmem_epan_scope(), "aoa ice");
-    xplane_data_lookup_table[126][3] = wmem_strbuf_new(wmem_epan_scope(), "lwing ice");
-    xplane_data_lookup_table[126][4] = wmem_strbuf_new(wmem_epan_scope(), "rwing ice");
-    xplane_data_lookup_table[126][5] = wmem_strbuf_new(wmem_epan_scope(), "windo ice");
-    xplane_data_lookup_table[126][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[126][7] = wmem_strbuf_new(wmem_epan_scope(), "carb1 ice");
-    xplane_data_lookup_table[126][8] = wmem_strbuf_new(wmem_epan_scope(), "carb2 ice");
-
-    xplane_data_lookup_table[127][0] = wmem_strbuf_new(wmem_epan_scope(), "Warning status");
-    xplane_data_lookup_table[127][1] = wmem_strbuf_new(wmem_epan_scope(), "warn time");
-    xplane_data_lookup_table[127][2] = wmem_strbuf_new(wmem_epan_scope(), "caut time");
-    xplane_data_lookup_table[127][3] = wmem_strbuf_new(wmem_epan_scope(), "warn work");
-    xplane_data_lookup_table[127][4] = wmem_strbuf_new(wmem_epan_scope(), "caut work");
-    xplane_data_lookup_table[127][5] = wmem_strbuf_new(wmem_epan_scope(), "gear work");
-    xplane_data_lookup_table[127][6] = wmem_strbuf_new(wmem_epan_scope(), "gear warn");
-    xplane_data_lookup_table[127][7] = wmem_strbuf_new(wmem_epan_scope(), "stall warn");
-    xplane_data_lookup_table[127][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[128][0] = wmem_strbuf_new(wmem_epan_scope(), "Flight plan legs");
-    xplane_data_lookup_table[128][1] = wmem_strbuf_new(wmem_epan_scope(), "leg #");
-    xplane_data_lookup_table[128][2] = wmem_strbuf_new(wmem_epan_scope(), "leg type");
-    xplane_data_lookup_table[128][3] = wmem_strbuf_new(wmem_epan_scope(), "leg lat");
-    xplane_data_lookup_table[128][4] = wmem_strbuf_new(wmem_epan_scope(), "leg long");
-    xplane_data_lookup_table[128][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[128][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[128][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[128][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[129][0] = wmem_strbuf_new(wmem_epan_scope(), "Hardware options");
-    xplane_data_lookup_table[129][1] = wmem_strbuf_new(wmem_epan_scope(), "pedal nobrk");
-    xplane_data_lookup_table[129][2] = wmem_strbuf_new(wmem_epan_scope(), "pedal wibrk");
-    xplane_data_lookup_table[129][3] = wmem_strbuf_new(wmem_epan_scope(), "yoke pfc");
-    xplane_data_lookup_table[129][4] = wmem_strbuf_new(wmem_epan_scope(), "pedal pfc");
-    xplane_data_lookup_table[129][5] = wmem_strbuf_new(wmem_epan_scope(), "throt pfc");
-    xplane_data_lookup_table[129][6] = wmem_strbuf_new(wmem_epan_scope(), "cecon pfc");
-    xplane_data_lookup_table[129][7] = wmem_strbuf_new(wmem_epan_scope(), "switc pfc");
-    xplane_data_lookup_table[129][8] = wmem_strbuf_new(wmem_epan_scope(), "btogg pfc");
-
-    xplane_data_lookup_table[130][0] = wmem_strbuf_new(wmem_epan_scope(), "Camera location");
-    xplane_data_lookup_table[130][1] = wmem_strbuf_new(wmem_epan_scope(), "camra long");
-    xplane_data_lookup_table[130][2] = wmem_strbuf_new(wmem_epan_scope(), "camra lat");
-    xplane_data_lookup_table[130][3] = wmem_strbuf_new(wmem_epan_scope(), "camra ele");
-    xplane_data_lookup_table[130][4] = wmem_strbuf_new(wmem_epan_scope(), "camra hdng");
-    xplane_data_lookup_table[130][5] = wmem_strbuf_new(wmem_epan_scope(), "camra pitch");
-    xplane_data_lookup_table[130][6] = wmem_strbuf_new(wmem_epan_scope(), "camra roll");
-    xplane_data_lookup_table[130][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[130][8] = wmem_strbuf_new(wmem_epan_scope(), "camra clou");
-
-    xplane_data_lookup_table[131][0] = wmem_strbuf_new(wmem_epan_scope(), "Ground location");
-    xplane_data_lookup_table[131][1] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][2] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[131][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[132][0] = wmem_strbuf_new(wmem_epan_scope(), "Climb stats");
-    xplane_data_lookup_table[132][1] = wmem_strbuf_new(wmem_epan_scope(), "h-spd kt");
-    xplane_data_lookup_table[132][2] = wmem_strbuf_new(wmem_epan_scope(), "v-spd fpm");
-    xplane_data_lookup_table[132][3] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[132][4] = wmem_strbuf_new(wmem_epan_scope(), "mult VxVVI");
-    xplane_data_lookup_table[132][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[132][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[132][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[132][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[133][0] = wmem_strbuf_new(wmem_epan_scope(), "Cruise stats");
-    xplane_data_lookup_table[133][1] = wmem_strbuf_new(wmem_epan_scope(), "ff pph");
-    xplane_data_lookup_table[133][2] = wmem_strbuf_new(wmem_epan_scope(), "ff gph");
-    xplane_data_lookup_table[133][3] = wmem_strbuf_new(wmem_epan_scope(), "speed mph");
-    xplane_data_lookup_table[133][4] = wmem_strbuf_new(wmem_epan_scope(), "eta smpg");
-    xplane_data_lookup_table[133][5] = wmem_strbuf_new(wmem_epan_scope(), "etc nm/lb");
-    xplane_data_lookup_table[133][6] = wmem_strbuf_new(wmem_epan_scope(), "range sm");
-    xplane_data_lookup_table[133][7] = wmem_strbuf_new(wmem_epan_scope(), "endur hours");
-    xplane_data_lookup_table[133][8] = wmem_strbuf_new(wmem_epan_scope(), "mult VxMPG");
-
-    xplane_data_lookup_table[134][0] = wmem_strbuf_new(wmem_epan_scope(), "Landing gear steering");
-    xplane_data_lookup_table[134][1] = wmem_strbuf_new(wmem_epan_scope(), "Gear 1 deg");
-    xplane_data_lookup_table[134][2] = wmem_strbuf_new(wmem_epan_scope(), "Gear 2 deg");
-    xplane_data_lookup_table[134][3] = wmem_strbuf_new(wmem_epan_scope(), "Gear 3 deg");
-    xplane_data_lookup_table[134][4] = wmem_strbuf_new(wmem_epan_scope(), "Gear 4 deg");
-    xplane_data_lookup_table[134][5] = wmem_strbuf_new(wmem_epan_scope(), "Gear 5 deg");
-    xplane_data_lookup_table[134][6] = wmem_strbuf_new(wmem_epan_scope(), "Gear 6 deg");
-    xplane_data_lookup_table[134][7] = wmem_strbuf_new(wmem_epan_scope(), "Gear 7 deg");
-    xplane_data_lookup_table[134][8] = wmem_strbuf_new(wmem_epan_scope(), "Gear 8 deg");
-
-    xplane_data_lookup_table[135][0] = wmem_strbuf_new(wmem_epan_scope(), "Motion platform stats");
-    xplane_data_lookup_table[135][1] = wmem_strbuf_new(wmem_epan_scope(), "acc-x m/ss");
-    xplane_data_lookup_table[135][2] = wmem_strbuf_new(wmem_epan_scope(), "acc-y m/ss");
-    xplane_data_lookup_table[135][3] = wmem_strbuf_new(wmem_epan_scope(), "acc-z m/ss");
-    xplane_data_lookup_table[135][4] = wmem_strbuf_new(wmem_epan_scope(), "P rad/s");
-    xplane_data_lookup_table[135][5] = wmem_strbuf_new(wmem_epan_scope(), "Q rad/s");
-    xplane_data_lookup_table[135][6] = wmem_strbuf_new(wmem_epan_scope(), "R rad/s");
-    xplane_data_lookup_table[135][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[135][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[136][0] = wmem_strbuf_new(wmem_epan_scope(), "Joystick Raw Axis Deflections");
-    xplane_data_lookup_table[136][1] = wmem_strbuf_new(wmem_epan_scope(), "axis1 ratio");
-    xplane_data_lookup_table[136][2] = wmem_strbuf_new(wmem_epan_scope(), "axis2 ratio");
-    xplane_data_lookup_table[136][3] = wmem_strbuf_new(wmem_epan_scope(), "axis3 ratio");
-    xplane_data_lookup_table[136][4] = wmem_strbuf_new(wmem_epan_scope(), "axis4 ratio");
-    xplane_data_lookup_table[136][5] = wmem_strbuf_new(wmem_epan_scope(), "axis5 ratio");
-    xplane_data_lookup_table[136][6] = wmem_strbuf_new(wmem_epan_scope(), "axis6 ratio");
-    xplane_data_lookup_table[136][7] = wmem_strbuf_new(wmem_epan_scope(), "axis7 ratio");
-    xplane_data_lookup_table[136][8] = wmem_strbuf_new(wmem_epan_scope(), "axis8 ratio");
-
-    xplane_data_lookup_table[137][0] = wmem_strbuf_new(wmem_epan_scope(), "Gear forces");
-    xplane_data_lookup_table[137][1] = wmem_strbuf_new(wmem_epan_scope(), "norm lb");
-    xplane_data_lookup_table[137][2] = wmem_strbuf_new(wmem_epan_scope(), "axial lb");
-    xplane_data_lookup_table[137][3] = wmem_strbuf_new(wmem_epan_scope(), "side lb");
-    xplane_data_lookup_table[137][4] = wmem_strbuf_new(wmem_epan_scope(), "L lb-ft");
-    xplane_data_lookup_table[137][5] = wmem_strbuf_new(wmem_epan_scope(), "M lb-ft");
-    xplane_data_lookup_table[137][6] = wmem_strbuf_new(wmem_epan_scope(), "N lb-ft");
-    xplane_data_lookup_table[137][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[137][8] = wmem_strbuf_new(wmem_epan_scope(), "");
-
-    xplane_data_lookup_table[138][0] = wmem_strbuf_new(wmem_epan_scope(), "Servo Aileron / Elevator / Rudder");
-    xplane_data_lookup_table[138][1] = wmem_strbuf_new(wmem_epan_scope(), "elev servo");
-    xplane_data_lookup_table[138][2] = wmem_strbuf_new(wmem_epan_scope(), "ailrn servo");
-    xplane_data_lookup_table[138][3] = wmem_strbuf_new(wmem_epan_scope(), "ruddr servo");
-    xplane_data_lookup_table[138][4] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[138][5] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[138][6] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[138][7] = wmem_strbuf_new(wmem_epan_scope(), "");
-    xplane_data_lookup_table[138][8] = wmem_strbuf_new(wmem_epan_scope(), "");
+static gint xplane_pref_data_table = -1;    // -1 picks the table from the host's BECN version
+static wmem_map_t* xplane_host_versions;    // address -> X-Plane major version from BECN
+
+const char* xplane_data_label(guint table, guint index, guint column)
+{
+    if (table >= xplane_DATA_TABLE_COUNT || index >= xplane_MAX_DATA_INDEX || column > xplane_DATA_VALUE_COUNT)
+        return "";
+    return xplane_data_strings + xplane_data_tables[table][index][column].label;
 }
 
-static int dissect_xplane_acfn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static guint xplane_host_hash(gconstpointer key)
 {
-    const guint8* path = NULL;
-    gint32 id, livery;
-    guint length = tvb_captured_length(tvb);
+    return add_address_to_hash(0, (const address*)key);
+}
+
+static gboolean xplane_host_equal(gconstpointer a, gconstpointer b)
+{
+    return addresses_equal((const address*)a, (const address*)b);
+}
 
-    proto_item* xplane_acfn_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_acfn_item, " Length=%u bytes.", length);
+static void xplane_note_host_version(packet_info* pinfo, gint32 version)
+{
+    // version_number is e.g. 115201 for 11.52r1
+    guint major = version > 0 ? (guint)version / 10000 : 0;
+    if (PINFO_FD_VISITED(pinfo) || major == 0 || GPOINTER_TO_UINT(wmem_map_lookup(xplane_host_versions, &pinfo->src)) == major)
+        return;
+
+    address* host = wmem_new(wmem_file_scope(), address);
+    copy_address_wmem(wmem_file_scope(), host, &pinfo->src);
+    wmem_map_insert(xplane_host_versions, host, GUINT_TO_POINTER(major));
+}
 
-    proto_tree* xplane_acfn_tree = proto_item_add_subtree(xplane_acfn_item, ett_xplane_acfn);
-    proto_tree_add_item(xplane_acfn_tree, hf_xplane_acfn_header, tvb, 0, 4, ENC_ASCII);
+// The label table for an X-Plane major version, 0 if unknown, unless the preference forces one.
+static guint xplane_data_table_for_version(guint major)
+{
+    if (xplane_pref_data_table >= 0 && xplane_pref_data_table < xplane_DATA_TABLE_COUNT)
+        return (guint)xplane_pref_data_table;
 
-    if (length != xplane_ACFN_PACKET_LENGTH)
+    guint table = 0;
+    for (guint t = 1; t < xplane_DATA_TABLE_COUNT; t++)
     {
-        expert_add_info_format(pinfo, xplane_acfn_item, &ei_xplane_acfn_length, "Required length of %u but received %u bytes.", xplane_ACFN_PACKET_LENGTH, length);
+        if (major >= xplane_data_table_versions[t])
+            table = t;
     }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_item* id_item = proto_tree_add_item_ret_int(xplane_acfn_tree, hf_xplane_acfn_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_item* path_item = proto_tree_add_item_ret_string(xplane_acfn_tree, hf_xplane_acfn_path, tvb_content, 4, 150, ENC_ASCII, wmem_packet_scope(), &path);
-        proto_tree_add_item(xplane_acfn_tree, hf_xplane_acfn_padding, tvb_content, 154, 2, ENC_ASCII);
-        proto_item* livery_item = proto_tree_add_item_ret_int(xplane_acfn_tree, hf_xplane_acfn_livery, tvb_content, 156, 4, ENC_LITTLE_ENDIAN, &livery);
+    return table;
+}
+
+static guint xplane_data_table_for(packet_info* pinfo)
+{
+    if (xplane_pref_data_table >= 0 && xplane_pref_data_table < xplane_DATA_TABLE_COUNT)
+        return (guint)xplane_pref_data_table;
 
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Id=%d Path=%s", id, path);
+    // Keep the first pass choice so a later BECN doesn't relabel frames already seen.
+    gpointer stored = p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_TABLE);
+    if (stored != NULL)
+        return GPOINTER_TO_UINT(stored) - 1;
 
-        if (id < 0 || id > 19)
-            expert_add_info_format(pinfo, id_item, &ei_xplane_acfn_id, "The provided Id [%u] must be either 0 (own Aircraft) or 1->19 (AI Aircraft).", id);
-        if (strchr(path, '\\') != NULL)
-            expert_add_info_format(pinfo, path_item, &ei_xplane_acfn_path_seperator, "For consistency the provided path [%s] could use the unix-style '/' path seperator. ", path);
-        if (livery < 0)
-            expert_add_info_format(pinfo, livery_item, &ei_xplane_acfn_livery, "The provided Livery Id [%u] must be 0 or greater.", livery);
-    }
-    return tvb_captured_length(tvb);
+    // DATA is sent by the simulator to a client or by a client to the simulator.
+    guint major = GPOINTER_TO_UINT(wmem_map_lookup(xplane_host_versions, &pinfo->src));
+    if (major == 0)
+        major = GPOINTER_TO_UINT(wmem_map_lookup(xplane_host_versions, &pinfo->dst));
+
+    guint table = xplane_data_table_for_version(major);
+
+    if (!PINFO_FD_VISITED(pinfo))
+        p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_TABLE, GUINT_TO_POINTER(table + 1));
+    return table;
 }
 
-static int dissect_xplane_acpr(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static int* const hf_xplane_data_generic[xplane_DATA_VALUE_COUNT] =
+{
+    &hf_xplane_data_a, &hf_xplane_data_b, &hf_xplane_data_c, &hf_xplane_data_d,
+    &hf_xplane_data_e, &hf_xplane_data_f, &hf_xplane_data_g, &hf_xplane_data_h
+};
+
+// ---------- Fixed Layout Engine ----------
+/*
+   Most of the fixed length messages are a flat struct of numbers and strings.
+   Rather than hand coding each one they are described by a constant table of
+   fields which dissect_xplane_layout() walks, reading each value exactly once.
+*/
+typedef enum
+{
+    xplane_FIELD_INT32,     /* gint32, little endian. */
+    xplane_FIELD_FLOAT,     /* IEEE float, little endian. */
+    xplane_FIELD_DOUBLE,    /* IEEE double, little endian. */
+    xplane_FIELD_STRING,    /* ASCII, NUL padded. A width of -1 takes the rest of the packet. */
+    xplane_FIELD_BYTES      /* Padding or opaque bytes. */
+} xplane_field_type_t;
+
+typedef enum
+{
+    xplane_CHECK_NONE,
+    xplane_CHECK_RANGE,     /* min <= value <= max */
+    xplane_CHECK_MIN,       /* min <= value */
+    xplane_CHECK_PATH       /* Strings only: prefer unix style '/' path seperators. */
+} xplane_check_t;
+
+typedef struct xplane_field_layout
+{
+    int* hf;
+    guint offset;               /* Offset from the end of the 5 byte header. */
+    gint width;
+    xplane_field_type_t type;
+    const char* col_label;      /* If set the value is appended to COL_INFO as " label=value". */
+    xplane_check_t check;
+    gdouble min;
+    gdouble max;
+    expert_field* ei;
+    const char* ei_text;        /* Completes "The provided <field> [<value>] ..." */
+} xplane_field_layout_t;
+
+typedef struct xplane_message_layout
+{
+    guint length;               /* Required packet length including the header. */
+    gint* ett;
+    int* hf_header;
+    expert_field* ei_length;
+    const char* col_suffix;     /* Appended to COL_INFO once all fields are added. */
+    const xplane_field_layout_t* fields;
+    guint field_count;
+} xplane_message_layout_t;
+
+typedef union xplane_field_value
+{
+    gint32 i;
+    gdouble d;                  /* xplane_FIELD_FLOAT values are widened. */
+    const guint8* s;
+} xplane_field_value_t;
+
+/*
+   Adds the message described by layout to the tree.
+   If values is not NULL it must have room for layout->field_count entries and receives each decoded value.
+   Returns the message's subtree, or NULL if there is no tree or the packet was the wrong length and no fields were added.
+*/
+static proto_tree* dissect_xplane_layout(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, const xplane_message_layout_t* layout, xplane_field_value_t* values)
 {
-    const guint8* path = NULL;
-    gint32 id, livery, runwaydirection;
-    gdouble latitude, longitude, elevation, trueheading, speed = 0;
     guint length = tvb_captured_length(tvb);
 
-    proto_item* xplane_acpr_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_acpr_item, " Length=%u bytes.", length);
+    proto_item* xplane_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_item, " Length=%u bytes.", length);
 
-    proto_tree* xplane_acpr_tree = proto_item_add_subtree(xplane_acpr_item, ett_xplane_acpr);
-    proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_header, tvb, 0, 4, ENC_ASCII);
+    proto_tree* xplane_tree = proto_item_add_subtree(xplane_item, *layout->ett);
+    proto_tree_add_item(xplane_tree, *layout->hf_header, tvb, 0, 4, ENC_ASCII);
 
-    if (length != xplane_ACPR_PACKET_LENGTH)
+    if (length != layout->length)
     {
-        expert_add_info_format(pinfo, xplane_acpr_item, &ei_xplane_acpr_length, "Required length %u but received %u", xplane_ACPR_PACKET_LENGTH, length);
+        expert_add_info_format(pinfo, xplane_item, layout->ei_length, "Length %u is invalid. Expected length %u", length, layout->length);
+        return NULL;
     }
-    else
+
+    // Range checks only feed expert items so skip them when there is no tree at all.
+    gboolean run_checks = (tree != NULL);
+
+    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+    for (guint i = 0; i < layout->field_count; i++)
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_item* id_item = proto_tree_add_item_ret_int(xplane_acpr_tree, hf_xplane_acpr_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_item* path_item = proto_tree_add_item_ret_string(xplane_acpr_tree, hf_xplane_acpr_path, tvb_content, 4, 150, ENC_ASCII, wmem_packet_scope(), &path);
-        proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_padding, tvb_content, 154, 2, ENC_LITTLE_ENDIAN);
-        proto_item* livery_item = proto_tree_add_item_ret_int(xplane_acpr_tree, hf_xplane_acpr_livery, tvb_content, 156, 4, ENC_LITTLE_ENDIAN, &livery);
-        proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_starttype, tvb_content, 160, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_aircraftindex, tvb_content, 164, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_ICAO, tvb_content, 168, 8, ENC_ASCII);
-        proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_runwayindex, tvb_content, 176, 4, ENC_LITTLE_ENDIAN);
-        proto_item* runwaydirection_item = proto_tree_add_item_ret_int(xplane_acpr_tree, hf_xplane_acpr_runwaydirection, tvb_content, 180, 4, ENC_LITTLE_ENDIAN, &runwaydirection);
-        proto_item* latitude_item = proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_latitude, tvb_content, 184, 8, ENC_LITTLE_ENDIAN);
-        proto_item* longitude_item = proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_longitude, tvb_content, 192, 8, ENC_LITTLE_ENDIAN);
-        proto_item* elevation_item = proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_elevation, tvb_content, 200, 8, ENC_LITTLE_ENDIAN);
-        proto_item* trueheading_item = proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_trueheading, tvb_content, 208, 8, ENC_LITTLE_ENDIAN);
-        proto_item* speed_item = proto_tree_add_item(xplane_acpr_tree, hf_xplane_acpr_speed, tvb_content, 216, 8, ENC_LITTLE_ENDIAN);
-
-        latitude = tvb_get_ieee_double(tvb_content, 184, ENC_LITTLE_ENDIAN);
-        longitude = tvb_get_ieee_double(tvb_content, 192, ENC_LITTLE_ENDIAN);
-        elevation = tvb_get_ieee_double(tvb_content, 200, ENC_LITTLE_ENDIAN);
-        trueheading = tvb_get_ieee_double(tvb_content, 208, ENC_LITTLE_ENDIAN);
-        speed = tvb_get_ieee_double(tvb_content, 216, ENC_LITTLE_ENDIAN);
-
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Id=%d Path=%s", id, path);
-
-        if (id < 0 || id > 19)
-            expert_add_info_format(pinfo, id_item, &ei_xplane_acpr_id, "The provided Id [%u] must be either 0 (own Aircraft) or 1->19 (AI Aircraft).", id);
-        if (strchr(path, '\\') != NULL)
-            expert_add_info_format(pinfo, path_item, &ei_xplane_acpr_path_seperator, "For consistency the provided path [%s] could use the unix-style '/' path seperator. ", path);
-        if (livery < 0)
-            expert_add_info_format(pinfo, livery_item, &ei_xplane_acpr_livery, "The provided Livery Id [%u] must be 0 or greater.", livery);
-        if (runwaydirection < 0 || runwaydirection> 1)
-            expert_add_info_format(pinfo, runwaydirection_item, &ei_xplane_acpr_runwaydirection, "The provided RunwayDirection [%u] must be 0 or 1.", runwaydirection);
-        if (latitude < -90 || latitude > 90)
-            expert_add_info_format(pinfo, latitude_item, &ei_xplane_acpr_latitude, "The provided Latitude [%lf] must be between -90 and +90.", latitude);
-        if (longitude < -180 || longitude > 180)
-            expert_add_info_format(pinfo, longitude_item, &ei_xplane_acpr_longitude, "The provided longitude [%lf] must be between -180 and +180.", longitude);
-        if (elevation < 0)
-            expert_add_info_format(pinfo, elevation_item, &ei_xplane_acpr_elevation, "The provided elevation [%lf] might not be valid.", elevation);
-        if (trueheading < 0 || trueheading > 360)
-            expert_add_info_format(pinfo, trueheading_item, &ei_xplane_acpr_trueheading, "The provided trueheading [%lf] might not be valid.", trueheading);
-        if (speed < 0)
-            expert_add_info_format(pinfo, speed_item, &ei_xplane_acpr_speed, "The provided speed [%lf] might not be valid.", speed);
+        const xplane_field_layout_t* field = &layout->fields[i];
+        xplane_field_value_t value = { 0 };
+        proto_item* item = NULL;
+        gdouble number = 0;
+
+        // Only decode fields which are displayed, filtered on, shown in a column, checked or wanted by the caller.
+        if (values == NULL && field->col_label == NULL && !(run_checks && field->check != xplane_CHECK_NONE) && !proto_field_is_referenced(tree, *field->hf))
+            continue;
+
+        switch (field->type)
+        {
+        case xplane_FIELD_INT32:
+            value.i = tvb_get_letohil(tvb_content, field->offset);
+            item = proto_tree_add_int(xplane_tree, *field->hf, tvb_content, field->offset, 4, value.i);
+            number = value.i;
+            if (field->col_label != NULL)
+                col_append_fstr(pinfo->cinfo, COL_INFO, " %s=%d", field->col_label, value.i);
+            break;
+        case xplane_FIELD_FLOAT:
+            value.d = tvb_get_letohieee_float(tvb_content, field->offset);
+            item = proto_tree_add_float(xplane_tree, *field->hf, tvb_content, field->offset, 4, (gfloat)value.d);
+            number = value.d;
+            if (field->col_label != NULL)
+                col_append_fstr(pinfo->cinfo, COL_INFO, " %s=%f", field->col_label, value.d);
+            break;
+        case xplane_FIELD_DOUBLE:
+            value.d = tvb_get_letohieee_double(tvb_content, field->offset);
+            item = proto_tree_add_double(xplane_tree, *field->hf, tvb_content, field->offset, 8, value.d);
+            number = value.d;
+            if (field->col_label != NULL)
+                col_append_fstr(pinfo->cinfo, COL_INFO, " %s=%lf", field->col_label, value.d);
+            break;
+        case xplane_FIELD_STRING:
+            item = proto_tree_add_item_ret_string(xplane_tree, *field->hf, tvb_content, field->offset, field->width, ENC_ASCII, wmem_packet_scope(), &value.s);
+            if (field->col_label != NULL)
+                col_append_fstr(pinfo->cinfo, COL_INFO, " %s=%s", field->col_label, value.s);
+            break;
+        case xplane_FIELD_BYTES:
+            proto_tree_add_item(xplane_tree, *field->hf, tvb_content, field->offset, field->width, ENC_NA);
+            break;
+        }
+
+        switch (run_checks ? field->check : xplane_CHECK_NONE)
+        {
+        case xplane_CHECK_NONE:
+            break;
+        case xplane_CHECK_RANGE:
+        case xplane_CHECK_MIN:
+            if (number < field->min || (field->check == xplane_CHECK_RANGE && number > field->max))
+            {
+                if (field->type == xplane_FIELD_INT32)
+                    expert_add_info_format(pinfo, item, field->ei, "The provided %s [%d] %s", proto_registrar_get_name(*field->hf), value.i, field->ei_text);
+                else
+                    expert_add_info_format(pinfo, item, field->ei, "The provided %s [%lf] %s", proto_registrar_get_name(*field->hf), number, field->ei_text);
+            }
+            break;
+        case xplane_CHECK_PATH:
+            if (strchr((const char*)value.s, '\\') != NULL)
+                expert_add_info_format(pinfo, item, field->ei, "For consistency the provided path [%s] could use the unix-style '/' path seperator. ", value.s);
+            break;
+        }
+
+        if (values != NULL)
+            values[i] = value;
     }
-    return tvb_captured_length(tvb);
+
+    if (layout->col_suffix != NULL)
+        col_append_str(pinfo->cinfo, COL_INFO, layout->col_suffix);
+
+    return xplane_tree;
 }
 
-static int dissect_xplane_alrt(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
-{
-    guint length = tvb_captured_length(tvb);
+// ---------- Record Budget ----------
+/*
+   DATA, RADR-out, RREF-out and the DCOC/UCOC/DSEL/USEL id lists can carry
+   hundreds of records. Only the first "Maximum Expanded Records" of a packet
+   get their own items; the rest are folded into one summary item with their
+   count and the range of each field. Fields that a filter, column or colouring
+   rule uses are still added for those records, hidden and without a subtree,
+   so filters see every record.
+*/
+#define xplane_MAX_EXPANDED_RECORDS 64
+#define xplane_SUMMARY_MAX_FIELDS (1 + xplane_DATA_VALUE_COUNT)
 
-    proto_item* xplane_alrt_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_alrt_item, " Length=%u bytes.", length);
+static guint xplane_pref_max_records = xplane_MAX_EXPANDED_RECORDS;    // 0 expands every record
 
-    proto_tree* xplane_alrt_tree = proto_item_add_subtree(xplane_alrt_item, ett_xplane_alrt);
-    proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_header, tvb, 0, 4, ENC_ASCII);
+static int hf_xplane_records_not_expanded = -1;
 
-    if (length != xplane_ALRT_PACKET_LENGTH)
-    {
-        expert_add_info_format(pinfo, xplane_alrt_item, &ei_xplane_alrt_length, "Required length %u but received %u", xplane_ALRT_PACKET_LENGTH, length);
-    }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line1, tvb_content, 0, 240, ENC_ASCII);
-        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line2, tvb_content, 240, 240, ENC_ASCII);
-        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line3, tvb_content, 480, 240, ENC_ASCII);
-        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line4, tvb_content, 720, 240, ENC_ASCII);
-    }
-    return tvb_captured_length(tvb);
+typedef struct xplane_record_summary
+{
+    guint count;
+    guint field_count;
+    int* const* fields;                         // names the ranges in the summary item
+    gdouble min[xplane_SUMMARY_MAX_FIELDS];
+    gdouble max[xplane_SUMMARY_MAX_FIELDS];
+    guint seen[xplane_SUMMARY_MAX_FIELDS];      // values in each range, NaNs and flagged values are left out
+} xplane_record_summary_t;
+
+static void xplane_summary_init(xplane_record_summary_t* summary, int* const* fields, guint field_count)
+{
+    memset(summary, 0, sizeof *summary);
+    summary->fields = fields;
+    summary->field_count = MIN(field_count, xplane_SUMMARY_MAX_FIELDS);
 }
 
-static int dissect_xplane_becn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static gboolean xplane_record_is_expanded(guint record)
 {
-    const guint8* becn_name = NULL;
-    guint32 major, minor;
-    gint becn_name_length;
-    guint length = tvb_captured_length(tvb);
+    return xplane_pref_max_records == 0 || record < xplane_pref_max_records;
+}
 
-    proto_item* xplane_becn_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_becn_item, " Length=%u bytes.", length);
+// proto_field_is_referenced() is always TRUE for a visible tree; this is only TRUE when something uses the field.
+static gboolean xplane_field_is_filtered(int hf)
+{
+    return proto_registrar_get_nth(hf)->ref_type != HF_REF_TYPE_NONE;
+}
 
-    proto_tree* xplane_becn_tree = proto_item_add_subtree(xplane_becn_item, ett_xplane_becn);
-    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_header, tvb, 0, 4, ENC_ASCII);
+// Adds a field of a record past the budget, hidden, when something uses it.
+static proto_item* xplane_record_add_filtered(proto_tree* tree, int hf, tvbuff_t* tvb, gint offset, gint length, guint encoding)
+{
+    if (!xplane_field_is_filtered(hf))
+        return NULL;
+    proto_item* item = proto_tree_add_item(tree, hf, tvb, offset, length, encoding);
+    proto_item_set_hidden(item);
+    return item;
+}
 
-    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-    proto_tree_add_item_ret_uint(xplane_becn_tree, hf_xplane_becn_major, tvb_content, 0, 1, ENC_LITTLE_ENDIAN, &major);
-    proto_tree_add_item_ret_uint(xplane_becn_tree, hf_xplane_becn_minor, tvb_content, 1, 1, ENC_LITTLE_ENDIAN, &minor);
-    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_hostid, tvb_content, 2, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_version, tvb_content, 6, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_role, tvb_content, 10, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_port, tvb_content, 14, 2, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item_ret_string_and_length(xplane_becn_tree, hf_xplane_becn_name, tvb_content, 16, -1, ENC_ASCII, wmem_packet_scope(), &becn_name, &becn_name_length);
-    if (major == 1 && minor == 2)
+static void xplane_summary_add_value(xplane_record_summary_t* summary, guint field, gdouble value)
+{
+    if (field >= summary->field_count || value != value)
+        return;
+    if (summary->seen[field] == 0 || value < summary->min[field])
+        summary->min[field] = value;
+    if (summary->seen[field] == 0 || value > summary->max[field])
+        summary->max[field] = value;
+    summary->seen[field]++;
+}
+
+// The summary item covers the packet from offset, the first record not expanded, to the end.
+static void xplane_summary_add_tree(proto_tree* tree, tvbuff_t* tvb, gint offset, const xplane_record_summary_t* summary)
+{
+    if (summary->count == 0)
+        return;
+
+    wmem_strbuf_t* ranges = wmem_strbuf_new(wmem_packet_scope(), "");
+    for (guint f = 0; f < summary->field_count; f++)
     {
-        proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_raknetport, tvb_content, 16 + becn_name_length, 2, ENC_LITTLE_ENDIAN);
+        if (summary->seen[f] == 0)
+            continue;
+        wmem_strbuf_append_printf(ranges, "%s %s %g..%g", wmem_strbuf_get_len(ranges) == 0 ? ":" : ",",
+            proto_registrar_get_name(*summary->fields[f]), summary->min[f], summary->max[f]);
     }
 
-    col_append_fstr(pinfo->cinfo, COL_INFO, " Server=%s", becn_name);
+    proto_item* item = proto_tree_add_uint_format(tree, hf_xplane_records_not_expanded, tvb, offset, -1, summary->count,
+        "%u more records not expanded%s", summary->count, wmem_strbuf_get_str(ranges));
+    proto_item_set_generated(item);
+}
 
-    return tvb_captured_length(tvb);
+// ---------- String Pool ----------
+/*
+   Names that outlive a packet, such as RREF datarefs, are interned once per
+   capture. Per capture state keeps the small integer id, which is cheap to
+   store and compare, and the string for an id stays at the same address
+   until the capture is closed.
+*/
+#define xplane_STRING_NONE 0    // id of ""
+
+static wmem_map_t* xplane_string_ids;       // string -> id
+static wmem_array_t* xplane_strings;        // id -> const char*
+
+static void xplane_string_pool_init(void)
+{
+    const char* empty = "";
+
+    xplane_string_ids = wmem_map_new(wmem_file_scope(), g_str_hash, g_str_equal);
+    xplane_strings = wmem_array_new(wmem_file_scope(), sizeof(const char*));
+    wmem_array_append_one(xplane_strings, empty);
+    wmem_map_insert(xplane_string_ids, empty, GUINT_TO_POINTER(xplane_STRING_NONE));
 }
 
-static int dissect_xplane_cmnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static guint32 xplane_string_intern(const char* string)
 {
-    const guint8* cmnd_name = NULL;
-    guint length = tvb_captured_length(tvb);
+    gpointer id;
+    if (wmem_map_lookup_extended(xplane_string_ids, string, NULL, &id))
+        return GPOINTER_TO_UINT(id);
+
+    const char* copy = wmem_strdup(wmem_file_scope(), string);
+    guint32 new_id = wmem_array_get_count(xplane_strings);
+    wmem_array_append_one(xplane_strings, copy);
+    wmem_map_insert(xplane_string_ids, copy, GUINT_TO_POINTER(new_id));
+    return new_id;
+}
 
-    proto_item* xplane_cmnd_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_cmnd_item, " Length=%u bytes.", length);
+static const char* xplane_string(guint32 id)
+{
+    return *(const char**)wmem_array_index(xplane_strings, id);
+}
 
-    proto_tree* xplane_cmnd_tree = proto_item_add_subtree(xplane_cmnd_item, ett_xplane_cmnd);
-    proto_tree_add_item(xplane_cmnd_tree, hf_xplane_cmnd_header, tvb, 0, 4, ENC_ASCII);
+// ---------- Control To Effect Latency ----------
+/*
+   DREF, VEHX, PREL and ACPR sent to the simulator are kept in a per capture
+   list of pending actions until its outbound stream shows their effect:
+   a DREF's dataref reaching the written value in RREF or DATA, a VEHX or
+   lat/lon PREL/ACPR's position in RPOS, or for the other PREL/ACPR start
+   types any jump in the RPOS position. Actions are matched on the first pass
+   only; a newer action for the same target replaces an older one and actions
+   older than the "Control To Effect Timeout" preference are dropped.
+*/
+#define xplane_PROTO_DATA_ACTION 2      // the xplane_action_t sent in this frame
+#define xplane_PROTO_DATA_EFFECTS 3     // wmem_array_t of the xplane_action_t* this frame completed
+
+#define xplane_ACTION_TIMEOUT 5
+#define xplane_ACTION_POSITION_TOLERANCE 0.0001     // degrees, about 11m
+#define xplane_ACTION_JUMP_DISTANCE 0.01            // degrees, about 1km
+
+typedef enum
+{
+    xplane_ACTION_WRITE,        // DREF
+    xplane_ACTION_MOVE,         // to a known position
+    xplane_ACTION_RELOCATE      // to an airport or runway
+} xplane_action_kind_t;
 
-    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-    proto_tree_add_item_ret_string(xplane_cmnd_tree, hf_xplane_cmnd_command, tvb_content, 0, -1, ENC_ASCII, wmem_packet_scope(), &cmnd_name);
+typedef struct xplane_action
+{
+    xplane_action_kind_t kind;
+    xplane_action_message_t message;
+    address sim;
+    guint32 frame;
+    nstime_t time;
+
+    guint32 dataref;            // WRITE: interned
+    gfloat value;
+    gint data_index;            // WRITE: DATA cell carrying the dataref, -1 if none
+    gint data_column;
+
+    gdouble latitude;           // MOVE: target, RELOCATE: position when sent
+    gdouble longitude;
+    gboolean have_position;
+
+    guint32 effect_frame;       // 0 until the effect is seen
+    nstime_t latency;
+} xplane_action_t;
+
+typedef struct xplane_position
+{
+    gdouble latitude;
+    gdouble longitude;
+} xplane_position_t;
 
-    col_append_fstr(pinfo->cinfo, COL_INFO, " Cmnd=%s", cmnd_name);
+static guint xplane_pref_action_timeout = xplane_ACTION_TIMEOUT;
 
-    return tvb_captured_length(tvb);
-}
+static wmem_list_t* xplane_pending_actions;     // xplane_action_t*, oldest first
+static wmem_map_t* xplane_sim_positions;        // address -> latest RPOS xplane_position_t
 
-static int dissect_xplane_data(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static int hf_xplane_action_effect_in = -1;
+static int hf_xplane_action_latency = -1;
+static int hf_xplane_action_effect_of = -1;
+
+static expert_field ei_xplane_action_no_effect = EI_INIT;
+
+static const char* const xplane_action_message_names[xplane_ACTION_MESSAGE_COUNT] = { "DREF", "VEHX", "PREL", "ACPR" };
+
+const char* xplane_action_message_name(xplane_action_message_t message)
 {
-    guint length = tvb_captured_length(tvb);
+    return message < xplane_ACTION_MESSAGE_COUNT ? xplane_action_message_names[message] : "";
+}
 
-    proto_item* xplane_data_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_data_item, " Length=%u bytes.", length);
+static void xplane_action_init(void)
+{
+    xplane_pending_actions = wmem_list_new(wmem_file_scope());
+}
 
-    proto_tree* xplane_data_tree = proto_item_add_subtree(xplane_data_item, ett_xplane_data);
-    proto_tree_add_item(xplane_data_tree, hf_xplane_data_header, tvb, 0, 4, ENC_ASCII);
+static gboolean xplane_action_same_target(const xplane_action_t* a, const xplane_action_t* b)
+{
+    if (a->kind == xplane_ACTION_WRITE || b->kind == xplane_ACTION_WRITE)
+        return a->kind == b->kind && a->dataref == b->dataref && addresses_equal(&a->sim, &b->sim);
+    return addresses_equal(&a->sim, &b->sim);
+}
 
-    if (xplane_data_lookup_table_is_populated == FALSE)
+// Drops actions that timed out and, when replacing is not NULL, those it supersedes.
+static void xplane_actions_prune(const nstime_t* now, const xplane_action_t* replacing)
+{
+    wmem_list_frame_t* item = wmem_list_head(xplane_pending_actions);
+    while (item != NULL)
     {
-        xplane_populate_data_lookup_table();
-        xplane_data_lookup_table_is_populated = TRUE;
+        wmem_list_frame_t* next = wmem_list_frame_next(item);
+        const xplane_action_t* action = (const xplane_action_t*)wmem_list_frame_data(item);
+        nstime_t age;
+
+        nstime_delta(&age, now, &action->time);
+        if (age.secs >= (time_t)xplane_pref_action_timeout || (replacing != NULL && xplane_action_same_target(action, replacing)))
+            wmem_list_remove_frame(xplane_pending_actions, item);
+        item = next;
     }
+}
 
-    if ((length - 5) % xplane_DATA_STRUCT_LENGTH != 0)
+static void xplane_action_add(packet_info* pinfo, xplane_action_t* action)
+{
+    copy_address_wmem(wmem_file_scope(), &action->sim, &pinfo->dst);
+    action->frame = pinfo->num;
+    action->time = pinfo->abs_ts;
+
+    if (action->kind == xplane_ACTION_RELOCATE)
     {
-        expert_add_info_format(pinfo, xplane_data_item, &ei_xplane_data_length, "Length %u is invalid. Length-5 must be divisible by %u", length, xplane_DATA_STRUCT_LENGTH);
+        const xplane_position_t* position = (const xplane_position_t*)wmem_map_lookup(xplane_sim_positions, &pinfo->dst);
+        action->have_position = (position != NULL);
+        if (position != NULL)
+        {
+            action->latitude = position->latitude;
+            action->longitude = position->longitude;
+        }
     }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        guint recordCount = (length - 5) / xplane_DATA_STRUCT_LENGTH;
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
-        proto_item_append_text(xplane_data_item, " Count=%u", recordCount);
 
-        for (guint32 i = 0; i < recordCount; i++)
+    xplane_actions_prune(&pinfo->abs_ts, action);
+    wmem_list_append(xplane_pending_actions, action);
+    p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_ACTION, action);
+}
+
+static void xplane_action_new_write(packet_info* pinfo, xplane_action_message_t message, const char* dataref, gfloat value)
+{
+    xplane_action_t* action = wmem_new0(wmem_file_scope(), xplane_action_t);
+    action->kind = xplane_ACTION_WRITE;
+    action->message = message;
+    action->dataref = xplane_string_intern(dataref);
+    action->value = value;
+    action->data_index = -1;
+    action->data_column = -1;
+
+    // Look the dataref up in the DATA labels once so DATA packets only compare numbers.
+    xplane_data_labels_t labels = xplane_data_tables[xplane_data_table_for_version(GPOINTER_TO_UINT(wmem_map_lookup(xplane_host_versions, &pinfo->dst)))];
+    for (guint index = 0; index < xplane_MAX_DATA_INDEX && action->data_index < 0; index++)
+    {
+        for (guint column = 1; column <= xplane_DATA_VALUE_COUNT; column++)
         {
-            int32_t index = tvb_get_int32(tvb_content, xplane_DATA_STRUCT_LENGTH * i, ENC_LITTLE_ENDIAN);
-            if (index >= xplane_MAX_DATA_INDEX)
-            {
-                expert_add_info_format(pinfo, xplane_data_item, &ei_xplane_data_invalid_index, "Index %u is invalid. Expected value < %u", index, xplane_MAX_DATA_INDEX);
-            }
-            else
+            if (labels[index][column].dataref != 0 && strcmp(xplane_data_strings + labels[index][column].dataref, dataref) == 0)
             {
-                proto_tree* xplane_dataitem_tree = proto_tree_add_subtree_format(xplane_data_tree, tvb_content, xplane_DATA_STRUCT_LENGTH * i, xplane_DATA_STRUCT_LENGTH, ett_xplane_data, NULL, "DATA Index: %02d %s", index, wmem_strbuf_get_str(xplane_data_lookup_table[index][0]));
-                proto_item* itm_index = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_index, tvb_content, (xplane_DATA_STRUCT_LENGTH * i), 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_A = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_a, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 4, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_B = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_b, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 8, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_C = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_c, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 12, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_D = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_d, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 16, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_E = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_e, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 20, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_F = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_f, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 24, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_G = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_g, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 28, 4, ENC_LITTLE_ENDIAN);
-                proto_item* itm_H = proto_tree_add_item(xplane_dataitem_tree, hf_xplane_data_h, tvb_content, (xplane_DATA_STRUCT_LENGTH * i) + 32, 4, ENC_LITTLE_ENDIAN);
-
-                proto_item_append_text(itm_index, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][0]));
-                proto_item_append_text(itm_A, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][1]));
-                proto_item_append_text(itm_B, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][2]));
-                proto_item_append_text(itm_C, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][3]));
-                proto_item_append_text(itm_D, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][4]));
-                proto_item_append_text(itm_E, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][5]));
-                proto_item_append_text(itm_F, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][6]));
-                proto_item_append_text(itm_G, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][7]));
-                proto_item_append_text(itm_H, "   %s", wmem_strbuf_get_str(xplane_data_lookup_table[index][8]));
+                action->data_index = (gint)index;
+                action->data_column = (gint)column - 1;
+                break;
             }
         }
     }
-    return tvb_captured_length(tvb);
+
+    xplane_action_add(pinfo, action);
 }
 
-static int dissect_xplane_dcoc(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static void xplane_action_new_move(packet_info* pinfo, xplane_action_message_t message, gint32 aircraft, gboolean known_position, gdouble latitude, gdouble longitude)
 {
-    guint length = tvb_captured_length(tvb);
+    // RPOS only reports the user's own aircraft.
+    if (aircraft != 0)
+        return;
+
+    xplane_action_t* action = wmem_new0(wmem_file_scope(), xplane_action_t);
+    action->kind = known_position ? xplane_ACTION_MOVE : xplane_ACTION_RELOCATE;
+    action->message = message;
+    action->latitude = latitude;
+    action->longitude = longitude;
+    action->have_position = known_position;
+    xplane_action_add(pinfo, action);
+}
 
-    proto_item* xplane_dcoc_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_dcoc_item, " Length=%u bytes.", length);
+static void xplane_action_complete(packet_info* pinfo, wmem_list_frame_t* item)
+{
+    xplane_action_t* action = (xplane_action_t*)wmem_list_frame_data(item);
+    action->effect_frame = pinfo->num;
+    nstime_delta(&action->latency, &pinfo->abs_ts, &action->time);
+    wmem_list_remove_frame(xplane_pending_actions, item);
 
-    proto_tree* xplane_dcoc_tree = proto_item_add_subtree(xplane_dcoc_item, ett_xplane_dcoc);
-    proto_tree_add_item(xplane_dcoc_tree, hf_xplane_dcoc_header, tvb, 0, 4, ENC_ASCII);
+    wmem_array_t* effects = (wmem_array_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_EFFECTS);
+    if (effects == NULL)
+    {
+        effects = wmem_array_new(wmem_file_scope(), sizeof(xplane_action_t*));
+        p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_EFFECTS, effects);
+    }
+    wmem_array_append_one(effects, action);
+}
 
-    if ((length - 5) % 4 != 0)
+static gboolean xplane_actions_pending(packet_info* pinfo)
+{
+    if (PINFO_FD_VISITED(pinfo) || wmem_list_count(xplane_pending_actions) == 0)
+        return FALSE;
+    xplane_actions_prune(&pinfo->abs_ts, NULL);
+    return wmem_list_count(xplane_pending_actions) > 0;
+}
+
+static gboolean xplane_action_value_matches(const xplane_action_t* action, gfloat value)
+{
+    return ABS(value - action->value) <= 0.0001f * MAX(1.0f, ABS(action->value));
+}
+
+// The simulator's RREF values, call once xplane_actions_pending() is TRUE.
+static void xplane_actions_match_rref(packet_info* pinfo, guint32 dataref, gfloat value)
+{
+    wmem_list_frame_t* item = wmem_list_head(xplane_pending_actions);
+    while (item != NULL)
     {
-        expert_add_info_format(pinfo, xplane_dcoc_item, &ei_xplane_dcoc_length, "Length %u is invalid. Length-5 must be divisible by %u", length, 4);
+        wmem_list_frame_t* next = wmem_list_frame_next(item);
+        const xplane_action_t* action = (const xplane_action_t*)wmem_list_frame_data(item);
+        if (action->kind == xplane_ACTION_WRITE && action->dataref == dataref && addresses_equal(&action->sim, &pinfo->src) && xplane_action_value_matches(action, value))
+            xplane_action_complete(pinfo, item);
+        item = next;
     }
-    else
+}
+
+// The simulator's DATA records, call once xplane_actions_pending() is TRUE.
+static void xplane_actions_match_data(packet_info* pinfo, const xplane_data_record_t* records, guint count)
+{
+    wmem_list_frame_t* item = wmem_list_head(xplane_pending_actions);
+    while (item != NULL)
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        guint recordCount = tvb_captured_length(tvb_content) / xplane_DATA_INDEX_LENGTH;
-        proto_item_append_text(xplane_dcoc_item, " Count=%u", recordCount);
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
-        for (guint32 i = 0; i < recordCount; i++)
+        wmem_list_frame_t* next = wmem_list_frame_next(item);
+        const xplane_action_t* action = (const xplane_action_t*)wmem_list_frame_data(item);
+        if (action->kind == xplane_ACTION_WRITE && action->data_index >= 0 && addresses_equal(&action->sim, &pinfo->src))
         {
-            gint id;
-            proto_item* item = proto_tree_add_item_ret_int(xplane_dcoc_tree, hf_xplane_dcoc_id, tvb_content, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, ENC_LITTLE_ENDIAN, &id);
-            if (id < 0 || id > 255)
-                expert_add_info_format(pinfo, item, &ei_xplane_dcoc_id, "Id %u is invalid.", id);
+            for (guint r = 0; r < count; r++)
+            {
+                if (records[r].index == action->data_index && xplane_action_value_matches(action, records[r].values[action->data_column]))
+                {
+                    xplane_action_complete(pinfo, item);
+                    break;
+                }
+            }
         }
+        item = next;
     }
-    return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_dref(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+// Every RPOS position from the simulator, on the first pass.
+static void xplane_actions_match_position(packet_info* pinfo, gdouble latitude, gdouble longitude)
 {
-    const guint8* dref = NULL;
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_dref_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_dref_item, " Length=%u bytes.", length);
-
-    proto_tree* xplane_dref_tree = proto_item_add_subtree(xplane_dref_item, ett_xplane_dref);
-    proto_tree_add_item(xplane_dref_tree, hf_xplane_dref_header, tvb, 0, 4, ENC_ASCII);
-
-    if (length != xplane_DREF_PACKET_LENGTH)
+    xplane_position_t* position = (xplane_position_t*)wmem_map_lookup(xplane_sim_positions, &pinfo->src);
+    if (position == NULL)
     {
-        expert_add_info_format(pinfo, xplane_dref_item, &ei_xplane_dref_length, "Length %u is invalid. Length-5 must be %u", length, xplane_DREF_PACKET_LENGTH);
+        address* sim = wmem_new(wmem_file_scope(), address);
+        copy_address_wmem(wmem_file_scope(), sim, &pinfo->src);
+        position = wmem_new(wmem_file_scope(), xplane_position_t);
+        wmem_map_insert(xplane_sim_positions, sim, position);
     }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item(xplane_dref_tree, hf_xplane_dref_value, tvb_content, 0, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item_ret_string(xplane_dref_tree, hf_xplane_dref_dataref, tvb_content, 4, -1, ENC_ASCII, wmem_packet_scope(), &dref);
+    position->latitude = latitude;
+    position->longitude = longitude;
 
-        col_append_fstr(pinfo->cinfo, COL_INFO, " DRef=%s", dref);
+    if (!xplane_actions_pending(pinfo))
+        return;
+
+    wmem_list_frame_t* item = wmem_list_head(xplane_pending_actions);
+    while (item != NULL)
+    {
+        wmem_list_frame_t* next = wmem_list_frame_next(item);
+        xplane_action_t* action = (xplane_action_t*)wmem_list_frame_data(item);
+        if (action->kind != xplane_ACTION_WRITE && addresses_equal(&action->sim, &pinfo->src))
+        {
+            gdouble distance = MAX(ABS(latitude - action->latitude), ABS(longitude - action->longitude));
+            if (action->kind == xplane_ACTION_RELOCATE && !action->have_position)
+            {
+                // Nothing to compare against yet, the next RPOS has to move.
+                action->latitude = latitude;
+                action->longitude = longitude;
+                action->have_position = TRUE;
+            }
+            else if (action->kind == xplane_ACTION_MOVE ? distance <= xplane_ACTION_POSITION_TOLERANCE : distance >= xplane_ACTION_JUMP_DISTANCE)
+            {
+                xplane_action_complete(pinfo, item);
+            }
+        }
+        item = next;
     }
-    return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_dsel(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+// Adds the effect of an action packet and queues it to the tap.
+static void xplane_action_add_tree(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb)
 {
-    guint length = tvb_captured_length(tvb);
+    const xplane_action_t* action = (const xplane_action_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_ACTION);
+    if (action == NULL)
+        return;
 
-    proto_item* xplane_dsel_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_dsel_item, " Length=%u bytes.", length);
+    if (have_tap_listener(xplane_action_tap))
+    {
+        xplane_action_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_action_tap_info_t);
+        tap_info->message = action->message;
+        tap_queue_packet(xplane_action_tap, pinfo, tap_info);
+    }
 
-    proto_tree* xplane_dsel_tree = proto_item_add_subtree(xplane_dsel_item, ett_xplane_dsel);
-    proto_tree_add_item(xplane_dsel_tree, hf_xplane_dsel_header, tvb, 0, 4, ENC_ASCII);
+    if (tree == NULL)
+        return;
 
-    if ((length - 5) % 4 != 0)
+    if (action->effect_frame != 0)
     {
-        expert_add_info_format(pinfo, xplane_dsel_item, &ei_xplane_dsel_length, "Length %u is invalid. Length-5 must be divisible by %u", length, 4);
+        proto_item* item = proto_tree_add_uint(tree, hf_xplane_action_effect_in, tvb, 0, 0, action->effect_frame);
+        proto_item_set_generated(item);
+        item = proto_tree_add_time(tree, hf_xplane_action_latency, tvb, 0, 0, &action->latency);
+        proto_item_set_generated(item);
     }
-    else
+    else if (PINFO_FD_VISITED(pinfo))
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        guint recordCount = (length - 5) / xplane_DATA_INDEX_LENGTH;
-        proto_item_append_text(xplane_dsel_item, " Count=%u", recordCount);
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
+        proto_tree_add_expert_format(tree, pinfo, &ei_xplane_action_no_effect, tvb, 0, 0, "No effect seen within %u seconds", xplane_pref_action_timeout);
+    }
+}
+
+// Links a packet from the simulator back to the actions it completed and queues them to the tap.
+static void xplane_action_add_effects(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb)
+{
+    wmem_array_t* effects = (wmem_array_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_EFFECTS);
+    if (effects == NULL)
+        return;
+
+    gboolean tapping = have_tap_listener(xplane_action_tap);
+    for (guint i = 0; i < wmem_array_get_count(effects); i++)
+    {
+        const xplane_action_t* action = *(const xplane_action_t* const*)wmem_array_index(effects, i);
+        proto_item* item = proto_tree_add_uint(tree, hf_xplane_action_effect_of, tvb, 0, 0, action->frame);
+        proto_item_set_generated(item);
+
+        if (tapping)
+        {
+            xplane_action_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_action_tap_info_t);
+            tap_info->message = action->message;
+            tap_info->latency = &action->latency;
+            tap_queue_packet(xplane_action_tap, pinfo, tap_info);
+        }
+    }
+}
+
+// ---------- Aircraft Positions ----------
+#define xplane_FEET_TO_METRES 0.3048
+#define xplane_EARTH_RADIUS 6371008.8       // metres, mean radius
+
+// The layout values RPOS, VEHX, ACPR and PREL need: on the first pass for actions, and whenever positions are tapped.
+static gboolean xplane_position_values_wanted(packet_info* pinfo)
+{
+    return !PINFO_FD_VISITED(pinfo) || have_tap_listener(xplane_position_tap);
+}
+
+static void xplane_position_tap_queue(packet_info* pinfo, const address* sim, gint32 aircraft, gboolean reposition, gboolean known_position,
+    gdouble latitude, gdouble longitude, gdouble elevation, gdouble heading, gdouble pitch, gdouble roll)
+{
+    if (aircraft < 0 || aircraft >= xplane_AIRCRAFT_SLOTS || !have_tap_listener(xplane_position_tap))
+        return;
+
+    xplane_position_tap_info_t* tap_info = wmem_new(wmem_packet_scope(), xplane_position_tap_info_t);
+    tap_info->sim = sim;
+    tap_info->aircraft = aircraft;
+    tap_info->reposition = reposition;
+    tap_info->known_position = known_position;
+    tap_info->latitude = latitude;
+    tap_info->longitude = longitude;
+    tap_info->elevation = elevation;
+    tap_info->heading = heading;
+    tap_info->pitch = pitch;
+    tap_info->roll = roll;
+    tap_queue_packet(xplane_position_tap, pinfo, tap_info);
+}
+
+// ---------- Aircraft Slots ----------
+/*
+   ACFN and ACPR load an aircraft into one of the 20 slots and OBJN an object
+   into an object slot; ACPR, PREL, VEHX and OBJL then move them. Each
+   simulator has a table of what its slots hold, one array per field with the
+   object slots after the aircraft ones, so finding a slot's state is a single
+   index. The table is built on the first pass and every packet keeps the
+   state its slot was in before the packet.
+*/
+#define xplane_PROTO_DATA_SLOT 6
+#define xplane_OBJECT_SLOTS 64      // OBJN ids from here on aren't tracked
+#define xplane_SLOT_COUNT (xplane_AIRCRAFT_SLOTS + xplane_OBJECT_SLOTS)
+
+typedef struct xplane_slot_table
+{
+    guint32 path[xplane_SLOT_COUNT];            // interned .acf or object file, xplane_STRING_NONE until loaded
+    gint32 livery[xplane_SLOT_COUNT];           // -1 for objects
+    guint32 loaded_frame[xplane_SLOT_COUNT];    // ACFN, ACPR or OBJN that loaded the slot, 0 if none seen
+    gdouble latitude[xplane_SLOT_COUNT];        // NAN until moved to a known position
+    gdouble longitude[xplane_SLOT_COUNT];
+    gdouble elevation[xplane_SLOT_COUNT];
+    gdouble heading[xplane_SLOT_COUNT];
+    gdouble pitch[xplane_SLOT_COUNT];
+    gdouble roll[xplane_SLOT_COUNT];
+    guint32 update_frame[xplane_SLOT_COUNT];    // last ACPR, PREL, VEHX or OBJL for the slot, 0 if none seen
+} xplane_slot_table_t;
+
+typedef struct xplane_slot_context
+{
+    guint32 path;
+    gint32 livery;
+    guint32 loaded_frame;
+    guint32 update_frame;
+    gdouble distance;       // metres from the slot's last known position, NAN if either isn't known
+} xplane_slot_context_t;
+
+static wmem_map_t* xplane_slot_tables;      // sim address -> xplane_slot_table_t
+
+static int hf_xplane_slot_path = -1;
+static int hf_xplane_slot_livery = -1;
+static int hf_xplane_slot_loaded_in = -1;
+static int hf_xplane_slot_previous = -1;
+static int hf_xplane_slot_distance = -1;
+
+// The table index of an aircraft or object id, -1 if it has no slot.
+static gint xplane_slot_index(gint32 id, gboolean object)
+{
+    if (object)
+        return id >= 0 && id < xplane_OBJECT_SLOTS ? xplane_AIRCRAFT_SLOTS + id : -1;
+    return id >= 0 && id < xplane_AIRCRAFT_SLOTS ? id : -1;
+}
+
+static gdouble xplane_slot_distance(gdouble latitude1, gdouble longitude1, gdouble latitude2, gdouble longitude2)
+{
+    gdouble a = sin((latitude2 - latitude1) * G_PI / 360);
+    gdouble b = sin((longitude2 - longitude1) * G_PI / 360);
+    gdouble h = a * a + cos(latitude1 * G_PI / 180) * cos(latitude2 * G_PI / 180) * b * b;
+    return 2 * xplane_EARTH_RADIUS * asin(sqrt(MIN(h, 1.0)));
+}
+
+/*
+   On the first pass, keeps the state of the slot a packet to the simulator addresses
+   and returns the simulator's table for the caller to update, or NULL if there is no slot.
+   latitude and longitude are NAN when the packet doesn't give a position.
+*/
+static xplane_slot_table_t* xplane_slot_enter(packet_info* pinfo, gint slot, gdouble latitude, gdouble longitude)
+{
+    if (slot < 0)
+        return NULL;
+
+    xplane_slot_table_t* table = (xplane_slot_table_t*)wmem_map_lookup(xplane_slot_tables, &pinfo->dst);
+    if (table == NULL)
+    {
+        address* sim = wmem_new(wmem_file_scope(), address);
+        copy_address_wmem(wmem_file_scope(), sim, &pinfo->dst);
+        table = wmem_new0(wmem_file_scope(), xplane_slot_table_t);
+        for (guint i = 0; i < xplane_SLOT_COUNT; i++)
+            table->latitude[i] = table->longitude[i] = table->elevation[i] = table->heading[i] = table->pitch[i] = table->roll[i] = NAN;
+        wmem_map_insert(xplane_slot_tables, sim, table);
+    }
+
+    xplane_slot_context_t* context = wmem_new(wmem_file_scope(), xplane_slot_context_t);
+    context->path = table->path[slot];
+    context->livery = table->livery[slot];
+    context->loaded_frame = table->loaded_frame[slot];
+    context->update_frame = table->update_frame[slot];
+    context->distance = NAN;
+    if (!isnan(table->latitude[slot]) && !isnan(latitude) && !isnan(longitude))
+        context->distance = xplane_slot_distance(table->latitude[slot], table->longitude[slot], latitude, longitude);
+    p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_SLOT, context);
+    return table;
+}
+
+static void xplane_slot_load(xplane_slot_table_t* table, gint slot, packet_info* pinfo, const guint8* path, gint32 livery)
+{
+    table->path[slot] = xplane_string_intern((const char*)path);
+    table->livery[slot] = livery;
+    table->loaded_frame[slot] = pinfo->num;
+}
+
+// A NAN latitude or longitude leaves the slot's position unknown, e.g. a PREL to a runway.
+static void xplane_slot_move(xplane_slot_table_t* table, gint slot, packet_info* pinfo,
+    gdouble latitude, gdouble longitude, gdouble elevation, gdouble heading, gdouble pitch, gdouble roll)
+{
+    table->latitude[slot] = latitude;
+    table->longitude[slot] = longitude;
+    table->elevation[slot] = elevation;
+    table->heading[slot] = heading;
+    table->pitch[slot] = pitch;
+    table->roll[slot] = roll;
+    table->update_frame[slot] = pinfo->num;
+}
+
+// Adds what the packet's slot held before it.
+static void xplane_slot_add_tree(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb)
+{
+    const xplane_slot_context_t* context = (const xplane_slot_context_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_SLOT);
+    if (context == NULL || tree == NULL)
+        return;
+
+    proto_item* item;
+    if (context->loaded_frame != 0)
+    {
+        item = proto_tree_add_string(tree, hf_xplane_slot_path, tvb, 0, 0, xplane_string(context->path));
+        proto_item_set_generated(item);
+        if (context->livery >= 0)
+        {
+            item = proto_tree_add_int(tree, hf_xplane_slot_livery, tvb, 0, 0, context->livery);
+            proto_item_set_generated(item);
+        }
+        item = proto_tree_add_uint(tree, hf_xplane_slot_loaded_in, tvb, 0, 0, context->loaded_frame);
+        proto_item_set_generated(item);
+    }
+    if (context->update_frame != 0)
+    {
+        item = proto_tree_add_uint(tree, hf_xplane_slot_previous, tvb, 0, 0, context->update_frame);
+        proto_item_set_generated(item);
+    }
+    if (!isnan(context->distance))
+    {
+        item = proto_tree_add_double(tree, hf_xplane_slot_distance, tvb, 0, 0, context->distance);
+        proto_item_set_generated(item);
+    }
+}
+
+static const xplane_field_layout_t xplane_acfn_fields[] =
+{
+    { &hf_xplane_acfn_index,   0,   4,   xplane_FIELD_INT32,  "Id",   xplane_CHECK_RANGE, 0, 19, &ei_xplane_acfn_id,             "must be either 0 (own Aircraft) or 1->19 (AI Aircraft)." },
+    { &hf_xplane_acfn_path,    4,   150, xplane_FIELD_STRING, "Path", xplane_CHECK_PATH,  0, 0,  &ei_xplane_acfn_path_seperator, NULL },
+    { &hf_xplane_acfn_padding, 154, 2,   xplane_FIELD_BYTES,  NULL,   xplane_CHECK_NONE,  0, 0,  NULL,                           NULL },
+    { &hf_xplane_acfn_livery,  156, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_MIN,   0, 0,  &ei_xplane_acfn_livery,         "must be 0 or greater." }
+};
+
+static const xplane_message_layout_t xplane_acfn_layout = { xplane_ACFN_PACKET_LENGTH, &ett_xplane_acfn, &hf_xplane_acfn_header, &ei_xplane_acfn_length, NULL, xplane_acfn_fields, array_length(xplane_acfn_fields) };
+
+static int dissect_xplane_acfn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_acfn_fields)];
+    proto_tree* xplane_acfn_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_acfn_layout, PINFO_FD_VISITED(pinfo) ? NULL : values);
+    if (tvb_captured_length(tvb) != xplane_ACFN_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
+
+    if (!PINFO_FD_VISITED(pinfo))
+    {
+        gint slot = xplane_slot_index(values[0].i, FALSE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, NAN, NAN);
+        if (slots != NULL)
+            xplane_slot_load(slots, slot, pinfo, values[1].s, values[3].i);
+    }
+    xplane_slot_add_tree(xplane_acfn_tree, pinfo, tvb);
+    return tvb_captured_length(tvb);
+}
+
+static const xplane_field_layout_t xplane_acpr_fields[] =
+{
+    { &hf_xplane_acpr_index,           0,   4,   xplane_FIELD_INT32,  "Id",   xplane_CHECK_RANGE, 0,    19,  &ei_xplane_acpr_id,              "must be either 0 (own Aircraft) or 1->19 (AI Aircraft)." },
+    { &hf_xplane_acpr_path,            4,   150, xplane_FIELD_STRING, "Path", xplane_CHECK_PATH,  0,    0,   &ei_xplane_acpr_path_seperator,  NULL },
+    { &hf_xplane_acpr_padding,         154, 2,   xplane_FIELD_BYTES,  NULL,   xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_acpr_livery,          156, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_MIN,   0,    0,   &ei_xplane_acpr_livery,          "must be 0 or greater." },
+    { &hf_xplane_acpr_starttype,       160, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_acpr_aircraftindex,   164, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_acpr_ICAO,            168, 8,   xplane_FIELD_STRING, NULL,   xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_acpr_runwayindex,     176, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_acpr_runwaydirection, 180, 4,   xplane_FIELD_INT32,  NULL,   xplane_CHECK_RANGE, 0,    1,   &ei_xplane_acpr_runwaydirection, "must be 0 or 1." },
+    { &hf_xplane_acpr_latitude,        184, 8,   xplane_FIELD_DOUBLE, NULL,   xplane_CHECK_RANGE, -90,  90,  &ei_xplane_acpr_latitude,        "must be between -90 and +90." },
+    { &hf_xplane_acpr_longitude,       192, 8,   xplane_FIELD_DOUBLE, NULL,   xplane_CHECK_RANGE, -180, 180, &ei_xplane_acpr_longitude,       "must be between -180 and +180." },
+    { &hf_xplane_acpr_elevation,       200, 8,   xplane_FIELD_DOUBLE, NULL,   xplane_CHECK_MIN,   0,    0,   &ei_xplane_acpr_elevation,       "might not be valid." },
+    { &hf_xplane_acpr_trueheading,     208, 8,   xplane_FIELD_DOUBLE, NULL,   xplane_CHECK_RANGE, 0,    360, &ei_xplane_acpr_trueheading,     "might not be valid." },
+    { &hf_xplane_acpr_speed,           216, 8,   xplane_FIELD_DOUBLE, NULL,   xplane_CHECK_MIN,   0,    0,   &ei_xplane_acpr_speed,           "might not be valid." }
+};
+
+static const xplane_message_layout_t xplane_acpr_layout = { xplane_ACPR_PACKET_LENGTH, &ett_xplane_acpr, &hf_xplane_acpr_header, &ei_xplane_acpr_length, NULL, xplane_acpr_fields, array_length(xplane_acpr_fields) };
+
+static int dissect_xplane_acpr(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_acpr_fields)];
+    proto_tree* xplane_acpr_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_acpr_layout, xplane_position_values_wanted(pinfo) ? values : NULL);
+    if (tvb_captured_length(tvb) != xplane_ACPR_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
+
+    if (!PINFO_FD_VISITED(pinfo))
+    {
+        gboolean known_position = (values[4].i == xplane_START_LATLONG);
+        gint slot = xplane_slot_index(values[0].i, FALSE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, known_position ? values[9].d : NAN, values[10].d);
+        if (slots != NULL)
+        {
+            xplane_slot_load(slots, slot, pinfo, values[1].s, values[3].i);
+            xplane_slot_move(slots, slot, pinfo, known_position ? values[9].d : NAN, values[10].d, values[11].d, values[12].d, NAN, NAN);
+        }
+        xplane_action_new_move(pinfo, xplane_ACTION_ACPR, values[0].i, known_position, values[9].d, values[10].d);
+    }
+    if (xplane_position_values_wanted(pinfo))
+        xplane_position_tap_queue(pinfo, &pinfo->dst, values[0].i, TRUE, values[4].i == xplane_START_LATLONG, values[9].d, values[10].d, values[11].d, values[12].d, NAN, NAN);
+    xplane_slot_add_tree(xplane_acpr_tree, pinfo, tvb);
+    xplane_action_add_tree(xplane_acpr_tree, pinfo, tvb);
+    return tvb_captured_length(tvb);
+}
+
+static int dissect_xplane_alrt(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
+{
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_alrt_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_alrt_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_alrt_tree = proto_item_add_subtree(xplane_alrt_item, ett_xplane_alrt);
+    proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_header, tvb, 0, 4, ENC_ASCII);
+
+    if (length != xplane_ALRT_PACKET_LENGTH)
+    {
+        expert_add_info_format(pinfo, xplane_alrt_item, &ei_xplane_alrt_length, "Required length %u but received %u", xplane_ALRT_PACKET_LENGTH, length);
+    }
+    else
+    {
+        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line1, tvb_content, 0, 240, ENC_ASCII);
+        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line2, tvb_content, 240, 240, ENC_ASCII);
+        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line3, tvb_content, 480, 240, ENC_ASCII);
+        proto_tree_add_item(xplane_alrt_tree, hf_xplane_alrt_line4, tvb_content, 720, 240, ENC_ASCII);
+    }
+    return tvb_captured_length(tvb);
+}
+
+static int dissect_xplane_becn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    const guint8* becn_name = NULL;
+    guint32 major, minor;
+    gint32 version;
+    gint becn_name_length;
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_becn_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_becn_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_becn_tree = proto_item_add_subtree(xplane_becn_item, ett_xplane_becn);
+    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_header, tvb, 0, 4, ENC_ASCII);
+
+    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+    proto_tree_add_item_ret_uint(xplane_becn_tree, hf_xplane_becn_major, tvb_content, 0, 1, ENC_LITTLE_ENDIAN, &major);
+    proto_tree_add_item_ret_uint(xplane_becn_tree, hf_xplane_becn_minor, tvb_content, 1, 1, ENC_LITTLE_ENDIAN, &minor);
+    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_hostid, tvb_content, 2, 4, ENC_LITTLE_ENDIAN);
+    proto_tree_add_item_ret_int(xplane_becn_tree, hf_xplane_becn_version, tvb_content, 6, 4, ENC_LITTLE_ENDIAN, &version);
+    xplane_note_host_version(pinfo, version);
+    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_role, tvb_content, 10, 4, ENC_LITTLE_ENDIAN);
+    proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_port, tvb_content, 14, 2, ENC_LITTLE_ENDIAN);
+    proto_tree_add_item_ret_string_and_length(xplane_becn_tree, hf_xplane_becn_name, tvb_content, 16, -1, ENC_ASCII, wmem_packet_scope(), &becn_name, &becn_name_length);
+    if (major == 1 && minor == 2)
+    {
+        proto_tree_add_item(xplane_becn_tree, hf_xplane_becn_raknetport, tvb_content, 16 + becn_name_length, 2, ENC_LITTLE_ENDIAN);
+    }
+
+    col_append_fstr(pinfo->cinfo, COL_INFO, " Server=%s", becn_name);
+
+    return tvb_captured_length(tvb);
+}
+
+static int dissect_xplane_cmnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    const guint8* cmnd_name = NULL;
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_cmnd_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_cmnd_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_cmnd_tree = proto_item_add_subtree(xplane_cmnd_item, ett_xplane_cmnd);
+    proto_tree_add_item(xplane_cmnd_tree, hf_xplane_cmnd_header, tvb, 0, 4, ENC_ASCII);
+
+    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+    proto_tree_add_item_ret_string(xplane_cmnd_tree, hf_xplane_cmnd_command, tvb_content, 0, -1, ENC_ASCII, wmem_packet_scope(), &cmnd_name);
+
+    col_append_fstr(pinfo->cinfo, COL_INFO, " Cmnd=%s", cmnd_name);
+
+    return tvb_captured_length(tvb);
+}
+
+// ---------- Stream Cadence ----------
+/*
+   RPOS (out) should arrive at the rate the last RPOS (in) asked for. DATA
+   goes out at a rate set in the simulator which is never sent, so its period
+   is learned: the median of the first intervals, then followed by the on
+   time ones, and learned again if the stream stays off it. Each interval is
+   on time, late, a gap with samples missing, or a burst. A stream is one
+   simulator's RPOS or DATA to one client address and port, as each client
+   asks for its own RPOS rate and DATA can go to several. Every stream keeps
+   a fixed amount of state; the verdict is reached on the first pass and kept
+   with the packet.
+*/
+#define xplane_PROTO_DATA_CADENCE 7
+#define xplane_CADENCE_LEARN 8          // intervals the learned period starts from
+#define xplane_CADENCE_RELEARN 8        // intervals in a row not on time before the period is learned again
+#define xplane_CADENCE_BURST 0.5        // periods
+#define xplane_CADENCE_LATE 1.25
+#define xplane_CADENCE_GAP 1.75
+
+typedef struct xplane_cadence_key
+{
+    address sim;
+    address client;
+    guint32 port;                       // the client's
+} xplane_cadence_key_t;
+
+typedef struct xplane_cadence_stream
+{
+    nstime_t last;                      // the previous sample, unset before the first
+    gdouble requested;                  // period asked for by RPOS (in), 0 if none
+    gdouble learned;                    // 0 while learning
+    gdouble learning[xplane_CADENCE_LEARN];    // sorted
+    guint learnt;
+    guint off_period;
+} xplane_cadence_stream_t;
+
+static wmem_map_t* xplane_cadence_streams[xplane_STREAM_COUNT];     // xplane_cadence_key_t -> xplane_cadence_stream_t
+
+static int hf_xplane_cadence_interval = -1;
+static int hf_xplane_cadence_period = -1;
+static int hf_xplane_cadence_missing = -1;
+
+static expert_field ei_xplane_cadence_gap = EI_INIT;
+static expert_field ei_xplane_cadence_late = EI_INIT;
+static expert_field ei_xplane_cadence_burst = EI_INIT;
+
+static const char* const xplane_stream_names[xplane_STREAM_COUNT] = { "RPOS", "DATA" };
+
+const char* xplane_stream_name(xplane_stream_t stream)
+{
+    return stream < xplane_STREAM_COUNT ? xplane_stream_names[stream] : "";
+}
+
+static guint xplane_cadence_key_hash(gconstpointer key)
+{
+    const xplane_cadence_key_t* cadence_key = (const xplane_cadence_key_t*)key;
+    return add_address_to_hash(add_address_to_hash(cadence_key->port, &cadence_key->sim), &cadence_key->client);
+}
+
+static gboolean xplane_cadence_key_equal(gconstpointer a, gconstpointer b)
+{
+    const xplane_cadence_key_t* key_a = (const xplane_cadence_key_t*)a;
+    const xplane_cadence_key_t* key_b = (const xplane_cadence_key_t*)b;
+    return key_a->port == key_b->port && addresses_equal(&key_a->sim, &key_b->sim) && addresses_equal(&key_a->client, &key_b->client);
+}
+
+static xplane_cadence_stream_t* xplane_cadence_stream(xplane_stream_t stream, const address* sim, const address* client, guint32 port)
+{
+    // The lookup key only borrows the addresses, they are copied when the stream is added.
+    xplane_cadence_key_t key;
+    key.sim = *sim;
+    key.client = *client;
+    key.port = port;
+
+    xplane_cadence_stream_t* cadence = (xplane_cadence_stream_t*)wmem_map_lookup(xplane_cadence_streams[stream], &key);
+    if (cadence == NULL)
+    {
+        xplane_cadence_key_t* stored = wmem_new(wmem_file_scope(), xplane_cadence_key_t);
+        copy_address_wmem(wmem_file_scope(), &stored->sim, sim);
+        copy_address_wmem(wmem_file_scope(), &stored->client, client);
+        stored->port = port;
+        cadence = wmem_new0(wmem_file_scope(), xplane_cadence_stream_t);
+        nstime_set_unset(&cadence->last);
+        wmem_map_insert(xplane_cadence_streams[stream], stored, cadence);
+    }
+    return cadence;
+}
+
+// On the first pass, an RPOS (in) from a client asking a simulator for a new rate in Hz.
+static void xplane_cadence_request(packet_info* pinfo, const char* frequency)
+{
+    gdouble hz = g_ascii_strtod(frequency, NULL);
+    xplane_cadence_stream(xplane_STREAM_RPOS, &pinfo->dst, &pinfo->src, pinfo->srcport)->requested = hz > 0 ? 1 / hz : 0;
+}
+
+static void xplane_cadence_learn(xplane_cadence_stream_t* cadence, xplane_interval_t kind, gdouble interval)
+{
+    if (cadence->learned == 0)
+    {
+        guint i = cadence->learnt++;
+        for (; i > 0 && cadence->learning[i - 1] > interval; i--)
+            cadence->learning[i] = cadence->learning[i - 1];
+        cadence->learning[i] = interval;
+        if (cadence->learnt == xplane_CADENCE_LEARN)
+        {
+            cadence->learned = cadence->learning[xplane_CADENCE_LEARN / 2];
+            cadence->learnt = 0;
+        }
+    }
+    else if (kind == xplane_INTERVAL_ON_TIME)
+    {
+        cadence->learned += (interval - cadence->learned) / 16;
+        cadence->off_period = 0;
+    }
+    else if (++cadence->off_period == xplane_CADENCE_RELEARN)
+    {
+        cadence->learned = 0;
+        cadence->off_period = 0;
+    }
+}
+
+// On the first pass, times a simulator's RPOS (out) or DATA against the previous one sent to the same client.
+static void xplane_cadence_note(packet_info* pinfo, xplane_stream_t stream)
+{
+    xplane_cadence_stream_t* cadence = xplane_cadence_stream(stream, &pinfo->src, &pinfo->dst, pinfo->destport);
+    xplane_cadence_tap_info_t* sample = wmem_new0(wmem_file_scope(), xplane_cadence_tap_info_t);
+    sample->stream = stream;
+    sample->interval = -1;
+
+    if (!nstime_is_unset(&cadence->last))
+    {
+        nstime_t delta;
+        nstime_delta(&delta, &pinfo->abs_ts, &cadence->last);
+        gdouble interval = nstime_to_sec(&delta);
+
+        sample->interval = interval;
+        sample->requested = (cadence->requested > 0);
+        sample->period = sample->requested ? cadence->requested : cadence->learned;
+        if (sample->period > 0)
+        {
+            gdouble periods = interval / sample->period;
+            if (periods < xplane_CADENCE_BURST)
+                sample->kind = xplane_INTERVAL_BURST;
+            else if (periods <= xplane_CADENCE_LATE)
+                sample->kind = xplane_INTERVAL_ON_TIME;
+            else if (periods < xplane_CADENCE_GAP)
+                sample->kind = xplane_INTERVAL_LATE;
+            else
+            {
+                sample->kind = xplane_INTERVAL_GAP;
+                sample->missing = (guint32)MAX(floor(periods + 0.5) - 1, 1);
+            }
+        }
+        if (!sample->requested)
+            xplane_cadence_learn(cadence, sample->kind, interval);
+    }
+    cadence->last = pinfo->abs_ts;
+    p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_CADENCE, sample);
+}
+
+static void xplane_cadence_add_tree(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb)
+{
+    const xplane_cadence_tap_info_t* sample = (const xplane_cadence_tap_info_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_CADENCE);
+    if (sample == NULL)
+        return;
+
+    if (have_tap_listener(xplane_cadence_tap))
+    {
+        xplane_cadence_tap_info_t* tap_info = wmem_new(wmem_packet_scope(), xplane_cadence_tap_info_t);
+        *tap_info = *sample;
+        tap_info->sim = &pinfo->src;
+        tap_info->client = &pinfo->dst;
+        tap_info->port = pinfo->destport;
+        tap_queue_packet(xplane_cadence_tap, pinfo, tap_info);
+    }
+
+    if (tree == NULL || sample->interval < 0)
+        return;
+
+    proto_item* item = proto_tree_add_double(tree, hf_xplane_cadence_interval, tvb, 0, 0, sample->interval);
+    proto_item_set_generated(item);
+    if (sample->period > 0)
+    {
+        proto_item* period_item = proto_tree_add_double(tree, hf_xplane_cadence_period, tvb, 0, 0, sample->period);
+        proto_item_set_generated(period_item);
+    }
+
+    const char* name = xplane_stream_name(sample->stream);
+    switch (sample->kind)
+    {
+    case xplane_INTERVAL_UNKNOWN:
+    case xplane_INTERVAL_ON_TIME:
+        break;
+    case xplane_INTERVAL_LATE:
+        expert_add_info_format(pinfo, item, &ei_xplane_cadence_late, "%s %.3f s after the previous, expected every %.3f s", name, sample->interval, sample->period);
+        break;
+    case xplane_INTERVAL_GAP:
+        item = proto_tree_add_uint(tree, hf_xplane_cadence_missing, tvb, 0, 0, sample->missing);
+        proto_item_set_generated(item);
+        expert_add_info_format(pinfo, item, &ei_xplane_cadence_gap, "%u %s missing: %.3f s after the previous, expected every %.3f s", sample->missing, name, sample->interval, sample->period);
+        break;
+    case xplane_INTERVAL_BURST:
+        expert_add_info_format(pinfo, item, &ei_xplane_cadence_burst, "%s %.3f s after the previous, expected every %.3f s", name, sample->interval, sample->period);
+        break;
+    }
+}
+
+// ---------- DATA record decoding ----------
+/*
+   A DATA record is an int32 index followed by eight little endian floats.
+   Records are decoded in one pass straight from the packet bytes and every
+   value is classified as it goes, so the tree, expert and statistics code
+   work from the decoded record instead of fetching each float again.
+   The AVX2 and SSE2 paths are picked at compile time and give the same
+   records as the scalar loop; xplane-bench.c times them against the
+   per-field tvb accessors.
+*/
+#define xplane_DATA_EXPONENT_BITS 0x7F800000u
+#define xplane_DATA_SENTINEL_BITS 0xC479C000u   // -999.0f, X-Plane's "no value" marker
+
+static void xplane_data_decode_records(tvbuff_t* tvb, guint count, xplane_data_record_t* records)
+{
+    const guint8* raw = tvb_get_ptr(tvb, 0, count * xplane_DATA_STRUCT_LENGTH);
+
+    for (guint r = 0; r < count; r++, raw += xplane_DATA_STRUCT_LENGTH)
+    {
+        xplane_data_record_t* record = &records[r];
+        record->index = (gint32)pletoh32(raw);
+
+#if defined(xplane_DATA_DECODE_AVX2)
+        // All eight values in one 256 bit load, one compare each for the two masks
+        const __m256i exponent = _mm256_set1_epi32((int)xplane_DATA_EXPONENT_BITS);
+        const __m256i sentinel = _mm256_set1_epi32((int)xplane_DATA_SENTINEL_BITS);
+        __m256i values = _mm256_loadu_si256((const __m256i*)(raw + 4));
+
+        _mm256_storeu_si256((__m256i*)record->values, values);
+
+        __m256i nonfinite = _mm256_cmpeq_epi32(_mm256_and_si256(values, exponent), exponent);
+        record->nonfinite = (guint8)_mm256_movemask_ps(_mm256_castsi256_ps(nonfinite));
+        record->sentinel = (guint8)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(values, sentinel)));
+#elif defined(xplane_DATA_DECODE_SSE2)
+        const __m128i exponent = _mm_set1_epi32((int)xplane_DATA_EXPONENT_BITS);
+        const __m128i sentinel = _mm_set1_epi32((int)xplane_DATA_SENTINEL_BITS);
+        __m128i lo = _mm_loadu_si128((const __m128i*)(raw + 4));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(raw + 20));
+
+        _mm_storeu_si128((__m128i*)&record->values[0], lo);
+        _mm_storeu_si128((__m128i*)&record->values[4], hi);
+
+        __m128i lo_nonfinite = _mm_cmpeq_epi32(_mm_and_si128(lo, exponent), exponent);
+        __m128i hi_nonfinite = _mm_cmpeq_epi32(_mm_and_si128(hi, exponent), exponent);
+        record->nonfinite = (guint8)(_mm_movemask_ps(_mm_castsi128_ps(lo_nonfinite)) | (_mm_movemask_ps(_mm_castsi128_ps(hi_nonfinite)) << 4));
+
+        __m128i lo_sentinel = _mm_cmpeq_epi32(lo, sentinel);
+        __m128i hi_sentinel = _mm_cmpeq_epi32(hi, sentinel);
+        record->sentinel = (guint8)(_mm_movemask_ps(_mm_castsi128_ps(lo_sentinel)) | (_mm_movemask_ps(_mm_castsi128_ps(hi_sentinel)) << 4));
+#else
+        record->nonfinite = 0;
+        record->sentinel = 0;
+        for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+        {
+            union { guint32 bits; gfloat value; } word;
+            word.bits = pletoh32(raw + 4 + (4 * n));
+            record->values[n] = word.value;
+            if ((word.bits & xplane_DATA_EXPONENT_BITS) == xplane_DATA_EXPONENT_BITS)
+                record->nonfinite |= (guint8)(1u << n);
+            if (word.bits == xplane_DATA_SENTINEL_BITS)
+                record->sentinel |= (guint8)(1u << n);
+        }
+#endif
+    }
+}
+
+static int xplane_data_value_hf(xplane_data_labels_t labels, gint32 index, guint n)
+{
+    guint16 slot = labels[index][n + 1].field;
+    return slot != 0 ? hf_xplane_data_field[slot] : *hf_xplane_data_generic[n];
+}
+
+/*
+   A record's subtree is only needed when something will look at it: a visible tree,
+   a filter or column on one of its fields, or a flagged value that needs an expert item.
+   Filters that only test membership use xplane.data.present and skip the subtrees.
+*/
+static gboolean xplane_data_record_is_wanted(proto_tree* tree, xplane_data_labels_t labels, const xplane_data_record_t* record)
+{
+    if (record->nonfinite | record->sentinel)
+        return TRUE;
+    if (proto_field_is_referenced(tree, hf_xplane_data_index) || proto_field_is_referenced(tree, hf_xplane_data_field[labels[record->index][0].field]))
+        return TRUE;
+    for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+    {
+        if (proto_field_is_referenced(tree, xplane_data_value_hf(labels, record->index, n)))
+            return TRUE;
+    }
+    return FALSE;
+}
+
+#define xplane_DATA_ATTITUDE_INDEX 17     // pitch, roll, true heading, magnetic heading
+#define xplane_DATA_POSITION_INDEX 20     // latitude, longitude, feet above mean sea level, ...
+
+// The user's aircraft position from DATA, with its attitude when the same packet carries it.
+static void xplane_data_position_tap_queue(packet_info* pinfo, const xplane_data_record_t* records, guint count)
+{
+    const xplane_data_record_t* position = NULL;
+    const xplane_data_record_t* attitude = NULL;
+
+    for (guint r = 0; r < count; r++)
+    {
+        if (records[r].index == xplane_DATA_POSITION_INDEX)
+            position = &records[r];
+        else if (records[r].index == xplane_DATA_ATTITUDE_INDEX)
+            attitude = &records[r];
+    }
+    if (position == NULL)
+        return;
+
+    xplane_position_tap_queue(pinfo, &pinfo->src, 0, FALSE, TRUE, position->values[0], position->values[1], position->values[2] * xplane_FEET_TO_METRES,
+        attitude ? attitude->values[2] : NAN, attitude ? attitude->values[0] : NAN, attitude ? attitude->values[1] : NAN);
+}
+
+static int* const xplane_data_summary_fields[] =
+{
+    &hf_xplane_data_index,
+    &hf_xplane_data_a, &hf_xplane_data_b, &hf_xplane_data_c, &hf_xplane_data_d,
+    &hf_xplane_data_e, &hf_xplane_data_f, &hf_xplane_data_g, &hf_xplane_data_h
+};
+
+/*
+   An expanded record gets a subtree with all of its values. Past the record budget
+   only the values a filter uses, or that need an expert item, are added, hidden and
+   straight under the DATA tree.
+*/
+static void xplane_data_add_record(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb, xplane_data_labels_t labels, const xplane_data_record_t* record, guint offset, gboolean expanded)
+{
+    gint32 index = record->index;
+    int hf_title = hf_xplane_data_field[labels[index][0].field];
+    proto_tree* record_tree = tree;
+
+    if (expanded)
+    {
+        proto_item* xplane_dataitem = proto_tree_add_none_format(tree, hf_title, tvb, offset, xplane_DATA_STRUCT_LENGTH, "DATA Index: %02d %s", index, xplane_data_strings + labels[index][0].label);
+        record_tree = proto_item_add_subtree(xplane_dataitem, ett_xplane_data);
+    }
+    else if (xplane_field_is_filtered(hf_title))
+    {
+        proto_item_set_hidden(proto_tree_add_item(tree, hf_title, tvb, offset, xplane_DATA_STRUCT_LENGTH, ENC_NA));
+    }
+
+    if (expanded || xplane_field_is_filtered(hf_xplane_data_index))
+    {
+        proto_item* index_item = proto_tree_add_int(record_tree, hf_xplane_data_index, tvb, offset, 4, index);
+        if (!expanded)
+            proto_item_set_hidden(index_item);
+    }
+
+    for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+    {
+        int hf_value = xplane_data_value_hf(labels, index, n);
+        gboolean flagged = ((record->nonfinite | record->sentinel) >> n) & 1;
+        if (!expanded && !flagged && !xplane_field_is_filtered(hf_value))
+            continue;
+
+        proto_item* value_item = proto_tree_add_float(record_tree, hf_value, tvb, offset + 4 + (4 * n), 4, record->values[n]);
+        if (!expanded)
+            proto_item_set_hidden(value_item);
+
+        // Only the rare flagged values pay for an expert item.
+        if (flagged)
+        {
+            if ((record->nonfinite >> n) & 1)
+                expert_add_info_format(pinfo, value_item, &ei_xplane_data_nonfinite, "%s is not a finite number", proto_registrar_get_name(hf_value));
+            else
+                expert_add_info_format(pinfo, value_item, &ei_xplane_data_sentinel, "%s is -999 (not available)", proto_registrar_get_name(hf_value));
+        }
+    }
+}
+
+static int dissect_xplane_data(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_data_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_data_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_data_tree = proto_item_add_subtree(xplane_data_item, ett_xplane_data);
+    proto_tree_add_item(xplane_data_tree, hf_xplane_data_header, tvb, 0, 4, ENC_ASCII);
+
+    if ((length - 5) % xplane_DATA_STRUCT_LENGTH != 0)
+    {
+        expert_add_info_format(pinfo, xplane_data_item, &ei_xplane_data_length, "Length %u is invalid. Length-5 must be divisible by %u", length, xplane_DATA_STRUCT_LENGTH);
+    }
+    else
+    {
+        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+        guint recordCount = (length - 5) / xplane_DATA_STRUCT_LENGTH;
+        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
+        proto_item_append_text(xplane_data_item, " Count=%u", recordCount);
+
+        if (!PINFO_FD_VISITED(pinfo))
+            xplane_cadence_note(pinfo, xplane_STREAM_DATA);
+        xplane_cadence_add_tree(xplane_data_tree, pinfo, tvb);
+
+        // Without a tree, a tap listener or an action waiting for its effect only the column text is needed.
+        gboolean tapping = have_tap_listener(xplane_data_tap);
+        gboolean matching = xplane_actions_pending(pinfo);
+        gboolean tracking = have_tap_listener(xplane_position_tap);
+        if (tree == NULL && !tapping && !matching && !tracking)
+            return tvb_captured_length(tvb);
+
+        guint table = xplane_data_table_for(pinfo);
+        xplane_data_labels_t labels = xplane_data_tables[table];
+        xplane_data_record_t* records = wmem_alloc_array(wmem_packet_scope(), xplane_data_record_t, recordCount);
+        xplane_data_decode_records(tvb_content, recordCount, records);
+
+        if (matching)
+            xplane_actions_match_data(pinfo, records, recordCount);
+        if (tracking)
+            xplane_data_position_tap_queue(pinfo, records, recordCount);
+        xplane_action_add_effects(xplane_data_tree, pinfo, tvb);
+
+        if (tapping)
+        {
+            xplane_data_tap_info_t* tap_info = wmem_new(wmem_packet_scope(), xplane_data_tap_info_t);
+            tap_info->table = table;
+            tap_info->count = recordCount;
+            tap_info->records = records;
+            tap_queue_packet(xplane_data_tap, pinfo, tap_info);
+        }
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        guint8* present = (guint8*)wmem_alloc0(wmem_packet_scope(), xplane_DATA_PRESENT_LENGTH);
+        for (guint32 i = 0; i < recordCount; i++)
+        {
+            gint32 index = records[i].index;
+            if (index >= 0 && index < xplane_MAX_DATA_INDEX)
+                present[index >> 3] |= (guint8)(1u << (index & 7));
+        }
+        proto_item* present_item = proto_tree_add_bytes_with_length(xplane_data_tree, hf_xplane_data_present, tvb_content, 0, 0, present, xplane_DATA_PRESENT_LENGTH);
+        proto_item_set_generated(present_item);
+
+        xplane_record_summary_t summary;
+        xplane_summary_init(&summary, xplane_data_summary_fields, array_length(xplane_data_summary_fields));
+
         for (guint32 i = 0; i < recordCount; i++)
         {
-            gint id = 0;
-            proto_item* item = proto_tree_add_item_ret_int(xplane_dsel_tree, hf_xplane_dsel_id, tvb_content, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, ENC_LITTLE_ENDIAN, &id);
-            if (id < 0 || id > 255)
-                expert_add_info_format(pinfo, item, &ei_xplane_dsel_id, "Id %u is invalid.", id);
+            const xplane_data_record_t* record = &records[i];
+            gint32 index = record->index;
+            if (index < 0 || index >= xplane_MAX_DATA_INDEX)
+            {
+                expert_add_info_format(pinfo, xplane_data_item, &ei_xplane_data_invalid_index, "Index %d is invalid. Expected value < %u", index, xplane_MAX_DATA_INDEX);
+            }
+            else if (xplane_record_is_expanded(i))
+            {
+                if (xplane_data_record_is_wanted(tree, labels, record))
+                    xplane_data_add_record(xplane_data_tree, pinfo, tvb_content, labels, record, xplane_DATA_STRUCT_LENGTH * i, TRUE);
+            }
+            else
+            {
+                summary.count++;
+                xplane_summary_add_value(&summary, 0, index);
+                for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+                {
+                    if (!(((record->nonfinite | record->sentinel) >> n) & 1))
+                        xplane_summary_add_value(&summary, n + 1, record->values[n]);
+                }
+                xplane_data_add_record(xplane_data_tree, pinfo, tvb_content, labels, record, xplane_DATA_STRUCT_LENGTH * i, FALSE);
+            }
+        }
+
+        xplane_summary_add_tree(xplane_data_tree, tvb_content, xplane_DATA_STRUCT_LENGTH * xplane_pref_max_records, &summary);
+    }
+    return tvb_captured_length(tvb);
+}
+
+// DCOC, UCOC, DSEL and USEL are each a list of int32 DATA indices.
+static void xplane_add_index_list(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb, guint recordCount, int* hf_id, expert_field* ei_id)
+{
+    int* const summary_fields[] = { hf_id };
+    xplane_record_summary_t summary;
+    xplane_summary_init(&summary, summary_fields, array_length(summary_fields));
+
+    for (guint32 i = 0; i < recordCount; i++)
+    {
+        gint id = tvb_get_letohil(tvb, i * xplane_DATA_INDEX_LENGTH);
+        gboolean invalid = id < 0 || id > 255;
+        proto_item* item = NULL;
+
+        if (xplane_record_is_expanded(i))
+        {
+            item = proto_tree_add_int(tree, *hf_id, tvb, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, id);
+        }
+        else
+        {
+            summary.count++;
+            xplane_summary_add_value(&summary, 0, id);
+            if (invalid || xplane_field_is_filtered(*hf_id))
+            {
+                item = proto_tree_add_int(tree, *hf_id, tvb, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, id);
+                proto_item_set_hidden(item);
+            }
+        }
+
+        if (invalid)
+            expert_add_info_format(pinfo, item, ei_id, "Id %d is invalid.", id);
+    }
+
+    xplane_summary_add_tree(tree, tvb, xplane_DATA_INDEX_LENGTH * xplane_pref_max_records, &summary);
+}
+
+static int dissect_xplane_dcoc(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_dcoc_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_dcoc_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_dcoc_tree = proto_item_add_subtree(xplane_dcoc_item, ett_xplane_dcoc);
+    proto_tree_add_item(xplane_dcoc_tree, hf_xplane_dcoc_header, tvb, 0, 4, ENC_ASCII);
+
+    if ((length - 5) % 4 != 0)
+    {
+        expert_add_info_format(pinfo, xplane_dcoc_item, &ei_xplane_dcoc_length, "Length %u is invalid. Length-5 must be divisible by %u", length, 4);
+    }
+    else
+    {
+        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+        guint recordCount = tvb_captured_length(tvb_content) / xplane_DATA_INDEX_LENGTH;
+        proto_item_append_text(xplane_dcoc_item, " Count=%u", recordCount);
+        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        xplane_add_index_list(xplane_dcoc_tree, pinfo, tvb_content, recordCount, &hf_xplane_dcoc_id, &ei_xplane_dcoc_id);
+    }
+    return tvb_captured_length(tvb);
+}
+
+// ---------- DataRef Dictionary ----------
+/*
+   The "DataRef File" preference names a DataRefs.txt as shipped in X-Plane's
+   Resources/plugins folder:
+
+       sim/cockpit/radios/nav1_freq_hz<TAB>int<TAB>y<TAB>10Hz<TAB>Description
+
+   It is read once, when the preference is applied, into a hash table of
+   name -> type, units and writability. DREF and RREF requests cost one probe
+   per packet. RREF bindings only keep the interned dataref, and RREF values
+   find its entry through a cache keyed by that id, so each value costs one
+   integer probe and no string work. The cache is per capture and remembers
+   which load it was filled from, so a reloaded dictionary is never read
+   through a stale entry.
+*/
+typedef enum
+{
+    xplane_DATAREF_INT,
+    xplane_DATAREF_FLOAT,
+    xplane_DATAREF_DOUBLE,
+    xplane_DATAREF_BYTE
+} xplane_dataref_type_t;
+
+typedef struct xplane_dataref_info
+{
+    xplane_dataref_type_t type;
+    guint32 array_size;         // 0 for scalars
+    gboolean writable;
+    gboolean boolean;           // units are "boolean"
+    const char* type_name;      // as written in the file, e.g. "float[8]"
+    const char* units;
+} xplane_dataref_info_t;
+
+static const char* xplane_pref_dataref_file = "";
+
+// Replaced whenever the preference changes, so entries must not be kept beyond the packet being dissected.
+static wmem_allocator_t* xplane_dataref_scope;  // owns xplane_datarefs, replaced on every load
+static wmem_map_t* xplane_datarefs;             // name -> xplane_dataref_info_t
+static guint xplane_dataref_generation = 1;     // bumped by every load; cached entries from older loads are stale
+
+typedef struct xplane_dataref_cached
+{
+    guint generation;
+    const xplane_dataref_info_t* info;          // NULL if the dictionary doesn't know the dataref
+} xplane_dataref_cached_t;
+
+static wmem_map_t* xplane_dataref_cache;        // interned dataref -> xplane_dataref_cached_t
+
+static int hf_xplane_dataref_type = -1;
+static int hf_xplane_dataref_units = -1;
+static int hf_xplane_dataref_writable = -1;
+static int hf_xplane_dataref_int = -1;
+static int hf_xplane_dataref_bool = -1;
+
+static expert_field ei_xplane_dataref_element = EI_INIT;
+static expert_field ei_xplane_dataref_readonly = EI_INIT;
+
+static gboolean xplane_dataref_parse_type(const char* text, xplane_dataref_info_t* info)
+{
+    static const struct { const char* name; xplane_dataref_type_t type; } types[] =
+    {
+        { "int", xplane_DATAREF_INT },
+        { "float", xplane_DATAREF_FLOAT },
+        { "double", xplane_DATAREF_DOUBLE },
+        { "byte", xplane_DATAREF_BYTE }
+    };
+
+    for (guint i = 0; i < array_length(types); i++)
+    {
+        gsize length = strlen(types[i].name);
+        if (strncmp(text, types[i].name, length) != 0)
+            continue;
+
+        info->type = types[i].type;
+        info->array_size = 0;
+        // Older files list a few datarefs as "int/float"; the first type is the one RREF reads.
+        if (text[length] == '[')
+            info->array_size = (guint32)g_ascii_strtoull(text + length + 1, NULL, 10);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static void xplane_dataref_dictionary_load(void)
+{
+    static char* loaded_file = NULL;
+
+    if (g_strcmp0(loaded_file, xplane_pref_dataref_file) == 0)
+        return;
+    g_free(loaded_file);
+    loaded_file = g_strdup(xplane_pref_dataref_file);
+
+    if (xplane_dataref_scope != NULL)
+        wmem_destroy_allocator(xplane_dataref_scope);
+    xplane_dataref_scope = NULL;
+    xplane_datarefs = NULL;
+    xplane_dataref_generation++;
+
+    if (xplane_pref_dataref_file == NULL || xplane_pref_dataref_file[0] == '\0')
+        return;
+
+    gchar* contents = NULL;
+    GError* error = NULL;
+    if (!g_file_get_contents(xplane_pref_dataref_file, &contents, NULL, &error))
+    {
+        report_failure("X-Plane: couldn't read the DataRef file %s: %s", xplane_pref_dataref_file, error->message);
+        g_error_free(error);
+        return;
+    }
+
+    xplane_dataref_scope = wmem_allocator_new(WMEM_ALLOCATOR_BLOCK);
+    xplane_datarefs = wmem_map_new(xplane_dataref_scope, g_str_hash, g_str_equal);
+
+    // The first line is the file's version; every other line is one dataref.
+    gchar** lines = g_strsplit(contents, "\n", -1);
+    for (guint line = 1; lines[line] != NULL; line++)
+    {
+        gchar** columns = g_strsplit(g_strchomp(lines[line]), "\t", 5);
+        xplane_dataref_info_t info = { 0 };
+
+        if (g_strv_length(columns) >= 3 && strchr(columns[0], '/') != NULL && xplane_dataref_parse_type(columns[1], &info))
+        {
+            info.writable = (columns[2][0] == 'y');
+            info.type_name = wmem_strdup(xplane_dataref_scope, columns[1]);
+            info.units = columns[3] != NULL ? wmem_strdup(xplane_dataref_scope, columns[3]) : "";
+            info.boolean = (g_ascii_strncasecmp(info.units, "bool", 4) == 0);
+            wmem_map_insert(xplane_datarefs, wmem_strdup(xplane_dataref_scope, columns[0]), wmem_memdup(xplane_dataref_scope, &info, sizeof info));
         }
+        g_strfreev(columns);
+    }
+    g_strfreev(lines);
+    g_free(contents);
+}
+
+/*
+   Looks a requested dataref up in the dictionary. Array elements are requested
+   as "name[n]"; element receives n, or -1 for the whole dataref.
+   Returns NULL without a dictionary or for an unknown name.
+*/
+static const xplane_dataref_info_t* xplane_dataref_lookup(const char* dataref, gint* element)
+{
+    char name[512];
+
+    *element = -1;
+    if (xplane_datarefs == NULL || dataref == NULL)
+        return NULL;
+
+    const char* bracket = strchr(dataref, '[');
+    if (bracket == NULL)
+        return (const xplane_dataref_info_t*)wmem_map_lookup(xplane_datarefs, dataref);
+
+    gsize length = (gsize)(bracket - dataref);
+    if (length >= sizeof name)
+        return NULL;
+    memcpy(name, dataref, length);
+    name[length] = '\0';
+    *element = (gint)g_ascii_strtoll(bracket + 1, NULL, 10);
+    return (const xplane_dataref_info_t*)wmem_map_lookup(xplane_datarefs, name);
+}
+
+// The entry for an interned dataref, resolved once per dictionary load.
+static const xplane_dataref_info_t* xplane_dataref_lookup_id(guint32 dataref)
+{
+    if (xplane_datarefs == NULL || dataref == xplane_STRING_NONE)
+        return NULL;
+
+    xplane_dataref_cached_t* cached = (xplane_dataref_cached_t*)wmem_map_lookup(xplane_dataref_cache, GUINT_TO_POINTER(dataref));
+    if (cached == NULL)
+    {
+        cached = wmem_new0(wmem_file_scope(), xplane_dataref_cached_t);
+        wmem_map_insert(xplane_dataref_cache, GUINT_TO_POINTER(dataref), cached);
+    }
+    if (cached->generation != xplane_dataref_generation)
+    {
+        gint element;
+        cached->info = xplane_dataref_lookup(xplane_string(dataref), &element);
+        cached->generation = xplane_dataref_generation;
+    }
+    return cached->info;
+}
+
+/*
+   Adds the dictionary's description of a dataref as generated fields and, when
+   has_value is set, the value as the dataref's own type. Returns the
+   writability item for the caller's expert items.
+*/
+static proto_item* xplane_dataref_add_info(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb, gint offset, gint length,
+    const xplane_dataref_info_t* info, gint element, gboolean has_value, gfloat value)
+{
+    proto_item* item = proto_tree_add_string(tree, hf_xplane_dataref_type, tvb, offset, length, info->type_name);
+    proto_item_set_generated(item);
+    if (element >= 0 && (guint32)element >= info->array_size)
+        expert_add_info_format(pinfo, item, &ei_xplane_dataref_element, "Element %d is outside %s", element, info->type_name);
+
+    if (info->units[0] != '\0')
+    {
+        item = proto_tree_add_string(tree, hf_xplane_dataref_units, tvb, offset, length, info->units);
+        proto_item_set_generated(item);
+    }
+
+    proto_item* writable_item = proto_tree_add_boolean(tree, hf_xplane_dataref_writable, tvb, offset, length, info->writable);
+    proto_item_set_generated(writable_item);
+
+    // Every value travels as a float whatever the dataref's type.
+    if (has_value && info->boolean)
+    {
+        item = proto_tree_add_boolean(tree, hf_xplane_dataref_bool, tvb, offset, length, value != 0.0f);
+        proto_item_set_generated(item);
+    }
+    else if (has_value && (info->type == xplane_DATAREF_INT || info->type == xplane_DATAREF_BYTE) && value >= G_MININT32 && value <= G_MAXINT32)
+    {
+        item = proto_tree_add_int(tree, hf_xplane_dataref_int, tvb, offset, length, (gint32)value);
+        proto_item_set_generated(item);
+    }
+
+    return writable_item;
+}
+
+static const xplane_field_layout_t xplane_dref_fields[] =
+{
+    { &hf_xplane_dref_value,   0, 4,  xplane_FIELD_FLOAT,  NULL,   xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_dref_dataref, 4, -1, xplane_FIELD_STRING, "DRef", xplane_CHECK_NONE, 0, 0, NULL, NULL }
+};
+
+static const xplane_message_layout_t xplane_dref_layout = { xplane_DREF_PACKET_LENGTH, &ett_xplane_dref, &hf_xplane_dref_header, &ei_xplane_dref_length, NULL, xplane_dref_fields, array_length(xplane_dref_fields) };
+
+static int dissect_xplane_dref(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_dref_fields)];
+    proto_tree* xplane_dref_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_dref_layout, values);
+    if (tvb_captured_length(tvb) != xplane_DREF_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
+
+    if (!PINFO_FD_VISITED(pinfo))
+        xplane_action_new_write(pinfo, xplane_ACTION_DREF, (const char*)values[1].s, (gfloat)values[0].d);
+    xplane_action_add_tree(xplane_dref_tree, pinfo, tvb);
+    if (xplane_dref_tree == NULL)
+        return tvb_captured_length(tvb);
+
+    gint element;
+    const xplane_dataref_info_t* info = xplane_dataref_lookup((const char*)values[1].s, &element);
+    if (info != NULL)
+    {
+        proto_item* writable_item = xplane_dataref_add_info(xplane_dref_tree, pinfo, tvb, xplane_HEADER_LENGTH, 4, info, element, TRUE, (gfloat)values[0].d);
+        if (!info->writable)
+            expert_add_info_format(pinfo, writable_item, &ei_xplane_dataref_readonly, "%s is read only, X-Plane ignores DREF writes to it", values[1].s);
+    }
+    return tvb_captured_length(tvb);
+}
+
+static int dissect_xplane_dsel(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    guint length = tvb_captured_length(tvb);
+
+    proto_item* xplane_dsel_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
+    proto_item_append_text(xplane_dsel_item, " Length=%u bytes.", length);
+
+    proto_tree* xplane_dsel_tree = proto_item_add_subtree(xplane_dsel_item, ett_xplane_dsel);
+    proto_tree_add_item(xplane_dsel_tree, hf_xplane_dsel_header, tvb, 0, 4, ENC_ASCII);
+
+    if ((length - 5) % 4 != 0)
+    {
+        expert_add_info_format(pinfo, xplane_dsel_item, &ei_xplane_dsel_length, "Length %u is invalid. Length-5 must be divisible by %u", length, 4);
+    }
+    else
+    {
+        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+        guint recordCount = (length - 5) / xplane_DATA_INDEX_LENGTH;
+        proto_item_append_text(xplane_dsel_item, " Count=%u", recordCount);
+        col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        xplane_add_index_list(xplane_dsel_tree, pinfo, tvb_content, recordCount, &hf_xplane_dsel_id, &ei_xplane_dsel_id);
     }
     return tvb_captured_length(tvb);
 }
@@ -1952,11 +2591,137 @@ static int dissect_xplane_flir_in(tvbuff_t* tvb, packet_info* pinfo, proto_tree*
 
     col_append_fstr(pinfo->cinfo, COL_INFO, " Framerate=%s", framerate);
 
+    if (have_tap_listener(xplane_flir_tap))
+    {
+        xplane_flir_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_flir_tap_info_t);
+        tap_info->request = TRUE;
+        tap_info->sim = &pinfo->dst;
+        tap_info->framerate = g_ascii_strtod((const char*)framerate, NULL);
+        tap_queue_packet(xplane_flir_tap, pinfo, tap_info);
+    }
+
     return tvb_captured_length(tvb);
 }
 
+// ---------- FLIR Reassembly ----------
+// FLIR-out carries no frame number, only each fragment's index and the frame's fragment count.
+// A new frame starts when the index doesn't move forward or the count changes.
+#define xplane_PROTO_DATA_FLIR_FRAME 4
+#define xplane_FLIR_OUT_IMAGE_OFFSET 6
+
+typedef struct xplane_flir_stream
+{
+    guint32 frame;          // reassembly id of the frame being received, from 1
+    guint32 frameindex;
+    guint32 framecount;
+} xplane_flir_stream_t;
+
+typedef struct xplane_flir_frame
+{
+    guint32 frame;
+    gint32 height;
+    gint32 width;
+    tvbuff_t* image;
+} xplane_flir_frame_t;
+
+static wmem_map_t* xplane_flir_streams;     // sim address -> xplane_flir_stream_t
+
+static guint32 xplane_flir_frame_id(packet_info* pinfo, guint32 frameindex, guint32 framecount)
+{
+    if (PINFO_FD_VISITED(pinfo))
+        return GPOINTER_TO_UINT(p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_FLIR_FRAME));
+
+    xplane_flir_stream_t* stream = (xplane_flir_stream_t*)wmem_map_lookup(xplane_flir_streams, &pinfo->src);
+    if (stream == NULL)
+    {
+        address* host = wmem_new(wmem_file_scope(), address);
+        copy_address_wmem(wmem_file_scope(), host, &pinfo->src);
+        stream = wmem_new0(wmem_file_scope(), xplane_flir_stream_t);
+        wmem_map_insert(xplane_flir_streams, host, stream);
+        stream->frame = 1;
+    }
+    else if (frameindex <= stream->frameindex || framecount != stream->framecount)
+    {
+        stream->frame++;
+    }
+    stream->frameindex = frameindex;
+    stream->framecount = framecount;
+
+    p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_FLIR_FRAME, GUINT_TO_POINTER(stream->frame));
+    return stream->frame;
+}
+
+static tap_packet_status xplane_flir_eo_packet(void* tapdata, packet_info* pinfo, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    export_object_list_t* object_list = (export_object_list_t*)tapdata;
+    const xplane_flir_frame_t* frame = (const xplane_flir_frame_t*)data;
+
+    export_object_entry_t* entry = g_new0(export_object_entry_t, 1);
+    entry->pkt_num = pinfo->num;
+    entry->hostname = address_to_display(NULL, &pinfo->src);
+    entry->content_type = g_strdup("application/octet-stream");
+    entry->filename = g_strdup_printf("flir-%u-%dx%d.raw", frame->frame, frame->width, frame->height);
+    entry->payload_len = tvb_captured_length(frame->image);
+    entry->payload_data = (guint8*)tvb_memdup(NULL, frame->image, 0, entry->payload_len);
+    object_list->add_entry(object_list->gui_data, entry);
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_flir_reassemble(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, proto_item* index_item, gint32 height, gint32 width, guint32 frameindex, guint32 framecount)
+{
+    if (frameindex >= framecount)
+    {
+        expert_add_info(pinfo, index_item, &ei_xplane_flir_out_index);
+        return;
+    }
+
+    guint32 frame = xplane_flir_frame_id(pinfo, frameindex, framecount);
+    guint fragment_length = tvb_captured_length_remaining(tvb, xplane_FLIR_OUT_IMAGE_OFFSET);
+
+    if (have_tap_listener(xplane_flir_tap))
+    {
+        xplane_flir_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_flir_tap_info_t);
+        tap_info->sim = &pinfo->src;
+        tap_info->frame = frame;
+        tap_info->frameindex = frameindex;
+        tap_info->framecount = framecount;
+        tap_info->length = fragment_length;
+        tap_queue_packet(xplane_flir_tap, pinfo, tap_info);
+    }
+
+    gboolean save_fragmented = pinfo->fragmented;
+    pinfo->fragmented = TRUE;
+    fragment_head* frame_head = fragment_add_seq_check(&xplane_flir_reassembly_table, tvb, xplane_FLIR_OUT_IMAGE_OFFSET, pinfo, frame, NULL,
+        frameindex, fragment_length, frameindex + 1 < framecount);
+    tvbuff_t* image = process_reassembled_data(tvb, xplane_FLIR_OUT_IMAGE_OFFSET, pinfo, "Reassembled FLIR Frame", frame_head, &xplane_flir_frag_items, NULL, tree);
+    pinfo->fragmented = save_fragmented;
+
+    if (image == NULL)
+        return;
+
+    // The reassembled frame is built in one buffer sized from all of its fragments, so check it against the header.
+    guint image_length = tvb_captured_length(image);
+    proto_item* image_item = proto_tree_add_item(tree, hf_xplane_flir_out_image, image, 0, -1, ENC_NA);
+    if (height > 0 && width > 0 && image_length != (guint)height * (guint)width)
+        expert_add_info_format(pinfo, image_item, &ei_xplane_flir_out_size, "Frame is %u bytes, expected Height x Width = %u", image_length, (guint)height * (guint)width);
+
+    col_append_fstr(pinfo->cinfo, COL_INFO, " Frame=%u (%u bytes)", frame, image_length);
+
+    if (have_tap_listener(xplane_flir_eo_tap))
+    {
+        xplane_flir_frame_t* eo_frame = wmem_new(wmem_packet_scope(), xplane_flir_frame_t);
+        eo_frame->frame = frame;
+        eo_frame->height = height;
+        eo_frame->width = width;
+        eo_frame->image = image;
+        tap_queue_packet(xplane_flir_eo_tap, pinfo, eo_frame);
+    }
+}
+
 static int dissect_xplane_flir_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
 {
+    gint32 height, width;
     guint32 frameindex, framecount;
     guint length = tvb_captured_length(tvb);
 
@@ -1967,103 +2732,64 @@ static int dissect_xplane_flir_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree
     proto_tree_add_item(xplane_flir_out_tree, hf_xplane_flir_out_header, tvb, 0, 4, ENC_ASCII);
 
     tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-    proto_tree_add_item(xplane_flir_out_tree, hf_xplane_flir_out_height, tvb_content, 0, 2, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_flir_out_tree, hf_xplane_flir_out_width, tvb_content, 2, 2, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item_ret_uint(xplane_flir_out_tree, hf_xplane_flir_out_frameindex, tvb_content, 4, 1, ENC_NA, &frameindex);
+    proto_tree_add_item_ret_int(xplane_flir_out_tree, hf_xplane_flir_out_height, tvb_content, 0, 2, ENC_LITTLE_ENDIAN, &height);
+    proto_tree_add_item_ret_int(xplane_flir_out_tree, hf_xplane_flir_out_width, tvb_content, 2, 2, ENC_LITTLE_ENDIAN, &width);
+    proto_item* index_item = proto_tree_add_item_ret_uint(xplane_flir_out_tree, hf_xplane_flir_out_frameindex, tvb_content, 4, 1, ENC_NA, &frameindex);
     proto_tree_add_item_ret_uint(xplane_flir_out_tree, hf_xplane_flir_out_framecount, tvb_content, 5, 1, ENC_NA, &framecount);
-    proto_tree_add_item(xplane_flir_out_tree, hf_xplane_flir_out_imagedata, tvb_content, 6, -1, ENC_ASCII);
+    proto_tree_add_item(xplane_flir_out_tree, hf_xplane_flir_out_imagedata, tvb_content, xplane_FLIR_OUT_IMAGE_OFFSET, -1, ENC_NA);
 
     col_append_fstr(pinfo->cinfo, COL_INFO, " Index=%u Count=%u", frameindex, framecount);
 
+    xplane_flir_reassemble(tvb_content, pinfo, xplane_flir_out_tree, index_item, height, width, frameindex, framecount);
+
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_ise4(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_ise4_fields[] =
 {
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_ise4_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_ise4_item, " Length=%u bytes.", length);
-
-    proto_tree* xplane_ise4_tree = proto_item_add_subtree(xplane_ise4_item, ett_xplane_ise4);
-    proto_tree_add_item(xplane_ise4_tree, hf_xplane_ise4_header, tvb, 0, 4, ENC_ASCII);
+    { &hf_xplane_ise4_machinetype, 0,  4,  xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise4_address,     4,  16, xplane_FIELD_STRING, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise4_port,        20, 8,  xplane_FIELD_STRING, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise4_enabled,     28, 4,  xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL }
+};
 
-    if (length != xplane_ISE4_PACKET_LENGTH)
-    {
-        expert_add_info_format(pinfo, xplane_ise4_item, &ei_xplane_ise4_length, "Length %u is invalid. Expected length %u", length, xplane_ISE4_PACKET_LENGTH);
-    }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item(xplane_ise4_tree, hf_xplane_ise4_machinetype, tvb_content, 0, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_ise4_tree, hf_xplane_ise4_address, tvb_content, 4, 16, ENC_ASCII);
-        proto_tree_add_item(xplane_ise4_tree, hf_xplane_ise4_port, tvb_content, 20, 8, ENC_ASCII);
-        proto_tree_add_item(xplane_ise4_tree, hf_xplane_ise4_enabled, tvb_content, 28, 4, ENC_LITTLE_ENDIAN);
-    }
+static const xplane_message_layout_t xplane_ise4_layout = { xplane_ISE4_PACKET_LENGTH, &ett_xplane_ise4, &hf_xplane_ise4_header, &ei_xplane_ise4_length, NULL, xplane_ise4_fields, array_length(xplane_ise4_fields) };
 
+static int dissect_xplane_ise4(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    dissect_xplane_layout(tvb, pinfo, tree, &xplane_ise4_layout, NULL);
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_ise6(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_ise6_fields[] =
 {
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_ise6_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_ise6_item, " Length=%u bytes.", length);
+    { &hf_xplane_ise6_machinetype, 0,  4,  xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise6_address,     4,  65, xplane_FIELD_STRING, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise6_port,        69, 6,  xplane_FIELD_STRING, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_ise6_enabled,     76, 4,  xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL }
+};
 
-    proto_tree* xplane_ise6_tree = proto_item_add_subtree(xplane_ise6_item, ett_xplane_ise6);
-    proto_tree_add_item(xplane_ise6_tree, hf_xplane_ise6_header, tvb, 0, 4, ENC_ASCII);
+static const xplane_message_layout_t xplane_ise6_layout = { xplane_ISE6_PACKET_LENGTH, &ett_xplane_ise6, &hf_xplane_ise6_header, &ei_xplane_ise6_length, NULL, xplane_ise6_fields, array_length(xplane_ise6_fields) };
 
-    if (length != xplane_ISE4_PACKET_LENGTH)
-    {
-        expert_add_info_format(pinfo, xplane_ise6_item, &ei_xplane_ise6_length, "Length %u is invalid. Expected length %u", length, xplane_ISE6_PACKET_LENGTH);
-    }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item(xplane_ise6_tree, hf_xplane_ise6_machinetype, tvb_content, 0, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_ise6_tree, hf_xplane_ise6_address, tvb_content, 4, 65, ENC_ASCII);
-        proto_tree_add_item(xplane_ise6_tree, hf_xplane_ise6_port, tvb_content, 69, 6, ENC_ASCII);
-        proto_tree_add_item(xplane_ise6_tree, hf_xplane_ise6_enabled, tvb_content, 76, 4, ENC_LITTLE_ENDIAN);
-    }
+static int dissect_xplane_ise6(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    dissect_xplane_layout(tvb, pinfo, tree, &xplane_ise6_layout, NULL);
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_lsnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_lsnd_fields[] =
 {
-    gint32 index = 0;
-    const guint8* filename = NULL;
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_lsnd_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_lsnd_item, " Length=%u bytes.", length);
+    { &hf_xplane_lsnd_index,    0,  4,  xplane_FIELD_INT32,  "Index",    xplane_CHECK_RANGE, 0, 4, &ei_xplane_lsnd_index,     "might not be valid. Valid values are 0->4." },
+    { &hf_xplane_lsnd_speed,    4,  4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_lsnd_frequency, "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_lsnd_volume,   8,  4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_lsnd_volume,    "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_lsnd_filename, 12, -1, xplane_FIELD_STRING, "Filename", xplane_CHECK_NONE,  0, 0, NULL,                      NULL }
+};
 
-    proto_tree* xplane_lsnd_tree = proto_item_add_subtree(xplane_lsnd_item, ett_xplane_lsnd);
-    proto_tree_add_item(xplane_lsnd_tree, hf_xplane_lsnd_header, tvb, 0, 4, ENC_ASCII);
+static const xplane_message_layout_t xplane_lsnd_layout = { xplane_LSND_PACKET_LENGTH, &ett_xplane_lsnd, &hf_xplane_lsnd_header, &ei_xplane_lsnd_length, NULL, xplane_lsnd_fields, array_length(xplane_lsnd_fields) };
 
-    if (length != xplane_LSND_PACKET_LENGTH)
-    {
-        expert_add_info_format(pinfo, xplane_lsnd_item, &ei_xplane_lsnd_length, "Length %u is invalid. Expected length %u", length, xplane_LSND_PACKET_LENGTH);
-    }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item_ret_int(xplane_lsnd_tree, hf_xplane_lsnd_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &index);
-        proto_tree_add_item(xplane_lsnd_tree, hf_xplane_lsnd_speed, tvb_content, 4, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_lsnd_tree, hf_xplane_lsnd_volume, tvb_content, 8, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item_ret_string(xplane_lsnd_tree, hf_xplane_lsnd_filename, tvb_content, 12, -1, ENC_ASCII, wmem_packet_scope(), &filename);
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Index=%u Filename=%s", index, filename);
-
-        gfloat frequency = tvb_get_ieee_float(tvb_content, 4, ENC_LITTLE_ENDIAN);
-        gfloat volume = tvb_get_ieee_float(tvb_content, 8, ENC_LITTLE_ENDIAN);
-
-        if (index < 0 || index > 4)
-            expert_add_info_format(pinfo, xplane_lsnd_item, &ei_xplane_lsnd_index, "Possible invalid index %u. Valid calues 0->4.", index);
-        if (frequency < 0.0 || frequency > 1.0)
-            expert_add_info_format(pinfo, xplane_lsnd_item, &ei_xplane_lsnd_frequency, "Possible invalid frequency [%lf]. Values should be between 0.0 and 1.0.", frequency);
-        if (volume < 0.0 || volume > 1.0)
-            expert_add_info_format(pinfo, xplane_lsnd_item, &ei_xplane_lsnd_volume, "Possible invalid volume [%lf]. Values should be between 0 and 1.0.", volume);
-    }
+static int dissect_xplane_lsnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    dissect_xplane_layout(tvb, pinfo, tree, &xplane_lsnd_layout, NULL);
     return tvb_captured_length(tvb);
 }
 
@@ -2111,144 +2837,103 @@ static int dissect_xplane_nrec(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tr
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_objl(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_objl_fields[] =
 {
-    gint32 id, onground;
-    gdouble latitude, longitude, elevation;
-    gfloat psi, theta, phi, smokesize;
-    guint length = tvb_captured_length(tvb);
+    { &hf_xplane_objl_index,     0,  4, xplane_FIELD_INT32,  "Id", xplane_CHECK_NONE,  0,    0,   NULL,                      NULL },
+    { &hf_xplane_objl_padding1,  4,  4, xplane_FIELD_BYTES,  NULL, xplane_CHECK_NONE,  0,    0,   NULL,                      NULL },
+    { &hf_xplane_objl_latitude,  8,  8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -90,  90,  &ei_xplane_objl_latitude,  "must be between -90 and +90." },
+    { &hf_xplane_objl_longitude, 16, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -180, 180, &ei_xplane_objl_longitude, "must be between -180 and +180." },
+    { &hf_xplane_objl_elevation, 24, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_MIN,   0,    0,   &ei_xplane_objl_elevation, "might not be valid." },
+    { &hf_xplane_objl_psi,       32, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_objl_psi,       "might not be valid." },
+    { &hf_xplane_objl_theta,     36, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_objl_theta,     "might not be valid." },
+    { &hf_xplane_objl_phi,       40, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_objl_phi,       "might not be valid." },
+    { &hf_xplane_objl_onground,  44, 4, xplane_FIELD_INT32,  NULL, xplane_CHECK_RANGE, 0,    1,   &ei_xplane_objl_onground,  "can only be 0 (not on ground) or 1 (on ground)." },
+    { &hf_xplane_objl_smokesize, 48, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_MIN,   0,    0,   &ei_xplane_objl_smokesize, "cannot be less than 0." },
+    { &hf_xplane_objl_padding2,  52, 4, xplane_FIELD_BYTES,  NULL, xplane_CHECK_NONE,  0,    0,   NULL,                      NULL }
+};
 
-    proto_item* xplane_objl_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_objl_item, " Length=%u bytes.", length);
+static const xplane_message_layout_t xplane_objl_layout = { xplane_OBJL_PACKET_LENGTH, &ett_xplane_objl, &hf_xplane_objl_header, &ei_xplane_objl_length, NULL, xplane_objl_fields, array_length(xplane_objl_fields) };
 
-    proto_tree* xplane_objl_tree = proto_item_add_subtree(xplane_objl_item, ett_xplane_objl);
-    proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_header, tvb, 0, 4, ENC_ASCII);
+static int dissect_xplane_objl(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_objl_fields)];
+    proto_tree* xplane_objl_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_objl_layout, PINFO_FD_VISITED(pinfo) ? NULL : values);
+    if (tvb_captured_length(tvb) != xplane_OBJL_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
 
-    if (length != xplane_OBJL_PACKET_LENGTH)
+    if (!PINFO_FD_VISITED(pinfo))
     {
-        expert_add_info_format(pinfo, xplane_objl_item, &ei_xplane_objl_length, "Length %u is invalid. Expected length %u", length, xplane_OBJL_PACKET_LENGTH);
-    }
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item_ret_int(xplane_objl_tree, hf_xplane_objl_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_padding1, tvb_content, 4, 4, ENC_NA);
-        proto_item* latitude_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_latitude, tvb_content, 8, 8, ENC_LITTLE_ENDIAN);
-        proto_item* longitude_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_longitude, tvb_content, 16, 8, ENC_LITTLE_ENDIAN);
-        proto_item* elevation_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_elevation, tvb_content, 24, 8, ENC_LITTLE_ENDIAN);
-        proto_item* psi_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_psi, tvb_content, 32, 4, ENC_LITTLE_ENDIAN);
-        proto_item* theta_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_theta, tvb_content, 36, 4, ENC_LITTLE_ENDIAN);
-        proto_item* phi_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_phi, tvb_content, 40, 4, ENC_LITTLE_ENDIAN);
-        proto_item* onground_item = proto_tree_add_item_ret_int(xplane_objl_tree, hf_xplane_objl_onground, tvb_content, 44, 4, ENC_LITTLE_ENDIAN, &onground);
-        proto_item* smokesize_item = proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_smokesize, tvb_content, 48, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_objl_tree, hf_xplane_objl_padding2, tvb_content, 52, 4, ENC_NA);
-
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Id=%d", id);
-
-        latitude = tvb_get_ieee_double(tvb_content, 8, ENC_LITTLE_ENDIAN);
-        longitude = tvb_get_ieee_double(tvb_content, 16, ENC_LITTLE_ENDIAN);
-        elevation = tvb_get_ieee_double(tvb_content, 24, ENC_LITTLE_ENDIAN);
-        psi = tvb_get_ieee_float(tvb_content, 32, ENC_LITTLE_ENDIAN);
-        theta = tvb_get_ieee_float(tvb_content, 36, ENC_LITTLE_ENDIAN);
-        phi = tvb_get_ieee_float(tvb_content, 40, ENC_LITTLE_ENDIAN);
-        smokesize = tvb_get_ieee_float(tvb_content, 52, ENC_LITTLE_ENDIAN);
-
-        if (latitude < -90 || latitude > 90)
-            expert_add_info_format(pinfo, latitude_item, &ei_xplane_objl_latitude, "The provided Latitude [%lf] must be between -90 and +90.", latitude);
-        if (longitude < -180 || longitude > 180)
-            expert_add_info_format(pinfo, longitude_item, &ei_xplane_objl_longitude, "The provided longitude [%lf] must be between -180 and +180.", longitude);
-        if (elevation < 0)
-            expert_add_info_format(pinfo, elevation_item, &ei_xplane_objl_elevation, "The provided elevation [%lf] might not be valid.", elevation);
-        if (psi < 0 || psi > 360)
-            expert_add_info_format(pinfo, psi_item, &ei_xplane_objl_psi, "The provided psi [%f] might not be valid.", psi);
-        if (theta < 0 || theta > 360)
-            expert_add_info_format(pinfo, theta_item, &ei_xplane_objl_theta, "The provided theta [%f] might not be valid.", theta);
-        if (phi < 0 || phi > 360)
-            expert_add_info_format(pinfo, phi_item, &ei_xplane_objl_phi, "The provided phi [%f] might not be valid.", phi);
-        if (onground < 0 || onground > 1)
-            expert_add_info_format(pinfo, onground_item, &ei_xplane_objl_onground, "The provided onground [%u] can only be 0(not on ground) or 1(on ground).", onground);
-        if (smokesize < 0)
-            expert_add_info_format(pinfo, smokesize_item, &ei_xplane_objl_smokesize, "The provided smokesize [%f] cannot be less than 0.", smokesize);
+        gint slot = xplane_slot_index(values[0].i, TRUE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, values[2].d, values[3].d);
+        if (slots != NULL)
+            xplane_slot_move(slots, slot, pinfo, values[2].d, values[3].d, values[4].d, values[5].d, values[6].d, values[7].d);
     }
+    xplane_slot_add_tree(xplane_objl_tree, pinfo, tvb);
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_objn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_objn_fields[] =
 {
-    gint32 id = 0;
-    const guint8* filename = NULL;
-    guint length = tvb_captured_length(tvb);
+    { &hf_xplane_objn_index,    0, 4,  xplane_FIELD_INT32,  "Id",       xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_objn_filename, 4, -1, xplane_FIELD_STRING, "Filename", xplane_CHECK_NONE, 0, 0, NULL, NULL }
+};
 
-    proto_item* xplane_objn_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_objn_item, " Length=%u bytes.", length);
+static const xplane_message_layout_t xplane_objn_layout = { xplane_OBJN_PACKET_LENGTH, &ett_xplane_objn, &hf_xplane_objn_header, &ei_xplane_objn_length, NULL, xplane_objn_fields, array_length(xplane_objn_fields) };
 
-    proto_tree* xplane_objn_tree = proto_item_add_subtree(xplane_objn_item, ett_xplane_objn);
-    proto_tree_add_item(xplane_objn_tree, hf_xplane_objn_header, tvb, 0, 4, ENC_ASCII);
+static int dissect_xplane_objn(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_objn_fields)];
+    proto_tree* xplane_objn_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_objn_layout, PINFO_FD_VISITED(pinfo) ? NULL : values);
+    if (tvb_captured_length(tvb) != xplane_OBJN_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
 
-    if (length != xplane_OBJN_PACKET_LENGTH)
-    {
-        expert_add_info_format(pinfo, xplane_objn_item, &ei_xplane_objn_length, "Length %u is invalid. Expected length %u", length, xplane_OBJN_PACKET_LENGTH);
-    }
-    else
+    if (!PINFO_FD_VISITED(pinfo))
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item_ret_int(xplane_objn_tree, hf_xplane_objn_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_tree_add_item_ret_string(xplane_objn_tree, hf_xplane_objn_filename, tvb_content, 4, -1, ENC_ASCII, wmem_packet_scope(), &filename);
-
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Id=%d Filename=%s", id, filename);
+        gint slot = xplane_slot_index(values[0].i, TRUE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, NAN, NAN);
+        if (slots != NULL)
+            xplane_slot_load(slots, slot, pinfo, values[1].s, -1);
     }
+    xplane_slot_add_tree(xplane_objn_tree, pinfo, tvb);
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_prel(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_prel_fields[] =
 {
-    gint32 id, runwaydirection;
-    gdouble latitude, longitude, elevation, trueheading, speed = 0;
-    guint length = tvb_captured_length(tvb);
+    { &hf_xplane_prel_starttype,       0,  4, xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_prel_aircraftindex,   4,  4, xplane_FIELD_INT32,  "Id", xplane_CHECK_RANGE, 0,    19,  &ei_xplane_prel_id,              "must be either 0 (own Aircraft) or 1->19 (AI Aircraft)." },
+    { &hf_xplane_prel_ICAO,            8,  8, xplane_FIELD_STRING, NULL, xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_prel_runwayindex,     16, 4, xplane_FIELD_INT32,  NULL, xplane_CHECK_NONE,  0,    0,   NULL,                            NULL },
+    { &hf_xplane_prel_runwaydirection, 20, 4, xplane_FIELD_INT32,  NULL, xplane_CHECK_RANGE, 0,    1,   &ei_xplane_prel_runwaydirection, "must be 0 or 1." },
+    { &hf_xplane_prel_latitude,        24, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -90,  90,  &ei_xplane_prel_latitude,        "must be between -90 and +90." },
+    { &hf_xplane_prel_longitude,       32, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -180, 180, &ei_xplane_prel_longitude,       "must be between -180 and +180." },
+    { &hf_xplane_prel_elevation,       40, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_MIN,   0,    0,   &ei_xplane_prel_elevation,       "might not be valid." },
+    { &hf_xplane_prel_trueheading,     48, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_prel_trueheading,     "might not be valid." },
+    { &hf_xplane_prel_speed,           56, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_MIN,   0,    0,   &ei_xplane_prel_speed,           "might not be valid." }
+};
 
-    proto_item* xplane_prel_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_prel_item, " Length=%u bytes.", length);
+static const xplane_message_layout_t xplane_prel_layout = { xplane_PREL_PACKET_LENGTH, &ett_xplane_prel, &hf_xplane_prel_header, &ei_xplane_prel_length, NULL, xplane_prel_fields, array_length(xplane_prel_fields) };
 
-    proto_tree* xplane_prel_tree = proto_item_add_subtree(xplane_prel_item, ett_xplane_prel);
-    proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_header, tvb, 0, 4, ENC_ASCII);
+static int dissect_xplane_prel(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_prel_fields)];
+    proto_tree* xplane_prel_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_prel_layout, xplane_position_values_wanted(pinfo) ? values : NULL);
+    if (tvb_captured_length(tvb) != xplane_PREL_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
 
-    if (length != xplane_PREL_PACKET_LENGTH)
-        expert_add_info_format(pinfo, xplane_prel_item, &ei_xplane_prel_length, "Length %u is invalid. Expected length %u", length, xplane_PREL_PACKET_LENGTH);
-    else
+    if (!PINFO_FD_VISITED(pinfo))
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_starttype, tvb_content, 0, 4, ENC_LITTLE_ENDIAN);
-        proto_item* id_item = proto_tree_add_item_ret_int(xplane_prel_tree, hf_xplane_prel_aircraftindex, tvb_content, 4, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_ICAO, tvb_content, 8, 8, ENC_ASCII);
-        proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_runwayindex, tvb_content, 16, 4, ENC_LITTLE_ENDIAN);
-        proto_item* runwaydirection_item = proto_tree_add_item_ret_int(xplane_prel_tree, hf_xplane_prel_runwaydirection, tvb_content, 20, 4, ENC_LITTLE_ENDIAN, &runwaydirection);
-        proto_item* latitude_item = proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_latitude, tvb_content, 24, 8, ENC_LITTLE_ENDIAN);
-        proto_item* longitude_item = proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_longitude, tvb_content, 32, 8, ENC_LITTLE_ENDIAN);
-        proto_item* elevation_item = proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_elevation, tvb_content, 40, 8, ENC_LITTLE_ENDIAN);
-        proto_item* trueheading_item = proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_trueheading, tvb_content, 48, 8, ENC_LITTLE_ENDIAN);
-        proto_item* speed_item = proto_tree_add_item(xplane_prel_tree, hf_xplane_prel_speed, tvb_content, 56, 8, ENC_LITTLE_ENDIAN);
-
-        latitude = tvb_get_ieee_double(tvb_content, 24, ENC_LITTLE_ENDIAN);
-        longitude = tvb_get_ieee_double(tvb_content, 32, ENC_LITTLE_ENDIAN);
-        elevation = tvb_get_ieee_double(tvb_content, 40, ENC_LITTLE_ENDIAN);
-        trueheading = tvb_get_ieee_double(tvb_content, 48, ENC_LITTLE_ENDIAN);
-        speed = tvb_get_ieee_double(tvb_content, 56, ENC_LITTLE_ENDIAN);
-
-        if (id < 0 || id > 19)
-            expert_add_info_format(pinfo, id_item, &ei_xplane_prel_id, "The provided Id [%u] must be either 0 (own Aircraft) or 1->19 (AI Aircraft).", id);
-        if (runwaydirection < 0 || runwaydirection> 1)
-            expert_add_info_format(pinfo, runwaydirection_item, &ei_xplane_prel_runwaydirection, "The provided RunwayDirection [%u] must be 0 or 1.", runwaydirection);
-        if (latitude < -90 || latitude > 90)
-            expert_add_info_format(pinfo, latitude_item, &ei_xplane_prel_latitude, "The provided Latitude [%lf] must be between -90 and +90.", latitude);
-        if (longitude < -180 || longitude > 180)
-            expert_add_info_format(pinfo, longitude_item, &ei_xplane_prel_longitude, "The provided longitude [%lf] must be between -180 and +180.", longitude);
-        if (elevation < 0)
-            expert_add_info_format(pinfo, elevation_item, &ei_xplane_prel_elevation, "The provided elevation [%lf] might not be valid.", elevation);
-        if (trueheading < 0 || trueheading > 360)
-            expert_add_info_format(pinfo, trueheading_item, &ei_xplane_prel_trueheading, "The provided trueheading [%lf] might not be valid.", trueheading);
-        if (speed < 0)
-            expert_add_info_format(pinfo, speed_item, &ei_xplane_prel_speed, "The provided speed [%lf] might not be valid.", speed);
+        gboolean known_position = (values[0].i == xplane_START_LATLONG);
+        gint slot = xplane_slot_index(values[1].i, FALSE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, known_position ? values[5].d : NAN, values[6].d);
+        if (slots != NULL)
+            xplane_slot_move(slots, slot, pinfo, known_position ? values[5].d : NAN, values[6].d, values[7].d, values[8].d, NAN, NAN);
+        xplane_action_new_move(pinfo, xplane_ACTION_PREL, values[1].i, known_position, values[5].d, values[6].d);
     }
+    if (xplane_position_values_wanted(pinfo))
+        xplane_position_tap_queue(pinfo, &pinfo->dst, values[1].i, TRUE, values[0].i == xplane_START_LATLONG, values[5].d, values[6].d, values[7].d, values[8].d, NAN, NAN);
+    xplane_slot_add_tree(xplane_prel_tree, pinfo, tvb);
+    xplane_action_add_tree(xplane_prel_tree, pinfo, tvb);
     return tvb_captured_length(tvb);
 }
 
@@ -2286,6 +2971,11 @@ static int dissect_xplane_radr_in(tvbuff_t* tvb, packet_info* pinfo, proto_tree*
     return tvb_captured_length(tvb);
 }
 
+static int* const xplane_radr_out_summary_fields[] =
+{
+    &hf_xplane_radr_out_longitude, &hf_xplane_radr_out_latitude, &hf_xplane_radr_out_precipitation, &hf_xplane_radr_out_height
+};
+
 static int dissect_xplane_radr_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
 {
     guint length = tvb_captured_length(tvb);
@@ -2306,14 +2996,56 @@ static int dissect_xplane_radr_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree
         tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
         col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
         proto_item_append_text(xplane_radr_out_item, " Count=%u", recordCount);
+
+        if (have_tap_listener(xplane_radr_tap))
+        {
+            xplane_radr_point_t* points = wmem_alloc_array(wmem_packet_scope(), xplane_radr_point_t, recordCount);
+            for (guint32 i = 0; i < recordCount; i++)
+            {
+                guint offset = xplane_RADR_OUT_STRUCT_LENGTH * i;
+                points[i].longitude = tvb_get_letohieee_float(tvb_content, offset);
+                points[i].latitude = tvb_get_letohieee_float(tvb_content, offset + 4);
+                points[i].precipitation = (gint8)tvb_get_guint8(tvb_content, offset + 8);
+                points[i].height = tvb_get_letohieee_float(tvb_content, offset + 9);
+            }
+
+            xplane_radr_tap_info_t* tap_info = wmem_new(wmem_packet_scope(), xplane_radr_tap_info_t);
+            tap_info->count = recordCount;
+            tap_info->points = points;
+            tap_queue_packet(xplane_radr_tap, pinfo, tap_info);
+        }
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        xplane_record_summary_t summary;
+        xplane_summary_init(&summary, xplane_radr_out_summary_fields, array_length(xplane_radr_out_summary_fields));
+
         for (guint32 i = 0; i < recordCount; i++)
         {
-            proto_tree* xplane_content_tree = proto_tree_add_subtree_format(xplane_radr_out_tree, tvb_content, xplane_RADR_OUT_STRUCT_LENGTH * i, xplane_RADR_OUT_STRUCT_LENGTH, ett_xplane_radr_out, NULL, "Element: %d", i);
-            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_longitude, tvb_content, (xplane_RADR_OUT_STRUCT_LENGTH * i), 4, ENC_LITTLE_ENDIAN);
-            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_latitude, tvb_content, (xplane_RADR_OUT_STRUCT_LENGTH * i) + 4, 4, ENC_LITTLE_ENDIAN);
-            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_precipitation, tvb_content, (xplane_RADR_OUT_STRUCT_LENGTH * i) + 8, 1, ENC_NA);
-            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_height, tvb_content, (xplane_RADR_OUT_STRUCT_LENGTH * i) + 9, 4, ENC_LITTLE_ENDIAN);
+            guint offset = xplane_RADR_OUT_STRUCT_LENGTH * i;
+            if (!xplane_record_is_expanded(i))
+            {
+                summary.count++;
+                xplane_summary_add_value(&summary, 0, tvb_get_letohieee_float(tvb_content, offset));
+                xplane_summary_add_value(&summary, 1, tvb_get_letohieee_float(tvb_content, offset + 4));
+                xplane_summary_add_value(&summary, 2, (gint8)tvb_get_guint8(tvb_content, offset + 8));
+                xplane_summary_add_value(&summary, 3, tvb_get_letohieee_float(tvb_content, offset + 9));
+                xplane_record_add_filtered(xplane_radr_out_tree, hf_xplane_radr_out_longitude, tvb_content, offset, 4, ENC_LITTLE_ENDIAN);
+                xplane_record_add_filtered(xplane_radr_out_tree, hf_xplane_radr_out_latitude, tvb_content, offset + 4, 4, ENC_LITTLE_ENDIAN);
+                xplane_record_add_filtered(xplane_radr_out_tree, hf_xplane_radr_out_precipitation, tvb_content, offset + 8, 1, ENC_NA);
+                xplane_record_add_filtered(xplane_radr_out_tree, hf_xplane_radr_out_height, tvb_content, offset + 9, 4, ENC_LITTLE_ENDIAN);
+                continue;
+            }
+
+            proto_tree* xplane_content_tree = proto_tree_add_subtree_format(xplane_radr_out_tree, tvb_content, offset, xplane_RADR_OUT_STRUCT_LENGTH, ett_xplane_radr_out, NULL, "Element: %d", i);
+            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_longitude, tvb_content, offset, 4, ENC_LITTLE_ENDIAN);
+            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_latitude, tvb_content, offset + 4, 4, ENC_LITTLE_ENDIAN);
+            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_precipitation, tvb_content, offset + 8, 1, ENC_NA);
+            proto_tree_add_item(xplane_content_tree, hf_xplane_radr_out_height, tvb_content, offset + 9, 4, ENC_LITTLE_ENDIAN);
         }
+
+        xplane_summary_add_tree(xplane_radr_out_tree, tvb_content, xplane_RADR_OUT_STRUCT_LENGTH * xplane_pref_max_records, &summary);
     }
 
     return tvb_captured_length(tvb);
@@ -2364,40 +3096,282 @@ static int dissect_xplane_rpos_in(tvbuff_t* tvb, packet_info* pinfo, proto_tree*
     proto_tree_add_item_ret_string(xplane_rpos_tree, hf_xplane_rpos_in_frequency, tvb_content, 0, -1, ENC_ASCII, wmem_packet_scope(), &frequency);
 
     col_append_fstr(pinfo->cinfo, COL_INFO, " Frequency=%s", frequency);
+    if (!PINFO_FD_VISITED(pinfo))
+        xplane_cadence_request(pinfo, (const char*)frequency);
 
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_rpos_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_rpos_out_fields[] =
 {
-    guint length = tvb_captured_length(tvb);
+    { &hf_xplane_rpos_out_longitude, 0,  8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_latitude,  8,  8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_elevation, 16, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_height,    24, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_theta,     28, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_psi,       32, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_phi,       36, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_vx,        40, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_vy,        44, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_vz,        48, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_rollrate,  52, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_pitchrate, 56, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL },
+    { &hf_xplane_rpos_out_yawrate,   60, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_NONE, 0, 0, NULL, NULL }
+};
 
-    proto_item* xplane_rpos_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_rpos_item, " Length=%u bytes.", length);
+static const xplane_message_layout_t xplane_rpos_out_layout = { xplane_RPOS_OUT_PACKET_LENGTH, &ett_xplane_rpos_out, &hf_xplane_rpos_out_header, &ei_xplane_rpos_out_length, " out", xplane_rpos_out_fields, array_length(xplane_rpos_out_fields) };
 
-    proto_tree* xplane_rpos_tree = proto_item_add_subtree(xplane_rpos_item, ett_xplane_rpos_out);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_header, tvb, 0, 4, ENC_ASCII);
+// ---------- RPOS Dead Reckoning ----------
+// Each RPOS is checked against the position the previous one's velocities predict for its capture time.
+// A large error means RPOS were lost, the capture timestamps jitter or the simulator stalled.
+#define xplane_PROTO_DATA_RPOS_PREDICTION 5
+#define xplane_RPOS_PREDICTION_THRESHOLD 20     // metres
+#define xplane_RPOS_PREDICTION_MAX_INTERVAL 5   // seconds, a longer gap isn't predicted
 
-    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_longitude, tvb_content, 0, 8, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_latitude, tvb_content, 8, 8, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_elevation, tvb_content, 16, 8, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_height, tvb_content, 24, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_theta, tvb_content, 28, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_psi, tvb_content, 32, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_phi, tvb_content, 36, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_vx, tvb_content, 40, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_vy, tvb_content, 44, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_vz, tvb_content, 48, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_rollrate, tvb_content, 52, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_pitchrate, tvb_content, 56, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_rpos_tree, hf_xplane_rpos_out_yawrate, tvb_content, 60, 4, ENC_LITTLE_ENDIAN);
-
-    col_append_str(pinfo->cinfo, COL_INFO, " out");
+typedef struct xplane_rpos_sample
+{
+    nstime_t time;
+    gdouble latitude;
+    gdouble longitude;
+    gdouble elevation;
+    gdouble vx;     // east, m/s
+    gdouble vy;     // up, m/s
+    gdouble vz;     // south, m/s
+} xplane_rpos_sample_t;
+
+typedef struct xplane_rpos_prediction
+{
+    gdouble error;          // metres
+    gdouble interval;       // seconds since the previous RPOS
+} xplane_rpos_prediction_t;
+
+static guint xplane_pref_rpos_prediction_threshold = xplane_RPOS_PREDICTION_THRESHOLD;
+static wmem_map_t* xplane_rpos_streams;     // sim address -> previous xplane_rpos_sample_t
+
+// On the first pass, predicts this RPOS from the sim's previous one and remembers it for the next.
+static void xplane_rpos_predict(packet_info* pinfo, const xplane_field_value_t* values)
+{
+    xplane_rpos_sample_t* previous = (xplane_rpos_sample_t*)wmem_map_lookup(xplane_rpos_streams, &pinfo->src);
+    if (previous == NULL)
+    {
+        address* sim = wmem_new(wmem_file_scope(), address);
+        copy_address_wmem(wmem_file_scope(), sim, &pinfo->src);
+        previous = wmem_new(wmem_file_scope(), xplane_rpos_sample_t);
+        wmem_map_insert(xplane_rpos_streams, sim, previous);
+    }
+    else
+    {
+        nstime_t delta;
+        nstime_delta(&delta, &pinfo->abs_ts, &previous->time);
+        gdouble interval = nstime_to_sec(&delta);
+        if (interval > 0 && interval <= xplane_RPOS_PREDICTION_MAX_INTERVAL)
+        {
+            // Small steps, so a local flat earth is close enough. vz points south.
+            gdouble north = (values[1].d - previous->latitude) * G_PI / 180 * xplane_EARTH_RADIUS + previous->vz * interval;
+            gdouble east = (values[0].d - previous->longitude) * G_PI / 180 * xplane_EARTH_RADIUS * cos(previous->latitude * G_PI / 180) - previous->vx * interval;
+            gdouble up = values[2].d - previous->elevation - previous->vy * interval;
+
+            xplane_rpos_prediction_t* prediction = wmem_new(wmem_file_scope(), xplane_rpos_prediction_t);
+            prediction->error = sqrt(north * north + east * east + up * up);
+            prediction->interval = interval;
+            p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_RPOS_PREDICTION, prediction);
+        }
+    }
+
+    previous->time = pinfo->abs_ts;
+    previous->longitude = values[0].d;
+    previous->latitude = values[1].d;
+    previous->elevation = values[2].d;
+    previous->vx = values[7].d;
+    previous->vy = values[8].d;
+    previous->vz = values[9].d;
+}
 
+static void xplane_rpos_add_prediction(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb)
+{
+    const xplane_rpos_prediction_t* prediction = (const xplane_rpos_prediction_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_RPOS_PREDICTION);
+    if (prediction == NULL)
+        return;
+
+    proto_item* item = proto_tree_add_double(tree, hf_xplane_rpos_out_prediction_error, tvb, 0, 0, prediction->error);
+    proto_item_set_generated(item);
+    if (prediction->error > xplane_pref_rpos_prediction_threshold)
+        expert_add_info_format(pinfo, item, &ei_xplane_rpos_out_prediction, "Position is %.1f m from the one predicted %.3f s after the previous RPOS", prediction->error, prediction->interval);
+}
+
+static int dissect_xplane_rpos_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_rpos_out_fields)];
+    proto_tree* xplane_rpos_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_rpos_out_layout, xplane_position_values_wanted(pinfo) ? values : NULL);
+    if (tvb_captured_length(tvb) != xplane_RPOS_OUT_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
+
+    if (!PINFO_FD_VISITED(pinfo))
+    {
+        xplane_actions_match_position(pinfo, values[1].d, values[0].d);
+        xplane_rpos_predict(pinfo, values);
+        xplane_cadence_note(pinfo, xplane_STREAM_RPOS);
+    }
+    xplane_rpos_add_prediction(xplane_rpos_tree, pinfo, tvb);
+    xplane_cadence_add_tree(xplane_rpos_tree, pinfo, tvb);
+    // RPOS is always the user's aircraft; theta, psi and phi are pitch, true heading and roll.
+    if (xplane_position_values_wanted(pinfo))
+        xplane_position_tap_queue(pinfo, &pinfo->src, 0, FALSE, TRUE, values[1].d, values[0].d, values[2].d, values[5].d, values[4].d, values[6].d);
+    xplane_action_add_effects(xplane_rpos_tree, pinfo, tvb);
     return tvb_captured_length(tvb);
 }
 
+// ---------- RREF subscriptions ----------
+/*
+   RREF ids are chosen by each client, so a subscription is identified by the
+   client's address and port as well as the id. Each key keeps the datarefs the
+   id has been bound to in frame order, so re-dissecting a frame finds the
+   binding that was in force at that frame.
+*/
+typedef struct xplane_rref_key
+{
+    address client;
+    guint32 port;
+    gint32 id;
+} xplane_rref_key_t;
+
+typedef struct xplane_rref_binding
+{
+    guint32 first_frame;
+    gint32 frequency;           // 0 once the client has unsubscribed
+    guint32 dataref;            // interned; its dictionary entry comes from xplane_dataref_lookup_id as it may be reloaded
+    nstime_t request_time;
+    guint32 first_value_frame;  // 0 until a value arrives under this binding
+    nstime_t latency;           // from the request to that first value
+} xplane_rref_binding_t;
+
+typedef struct xplane_rref_subscription
+{
+    wmem_array_t* bindings;     // xplane_rref_binding_t, ordered by first_frame
+    nstime_t last_value_time;   // unset until the first value, only valid during the first pass
+} xplane_rref_subscription_t;
+
+// Per frame array of each RREF value's time since its predecessor, unset for the first.
+#define xplane_PROTO_DATA_RREF_DELTAS 1
+
+static wmem_map_t* xplane_rref_subscriptions;   // xplane_rref_key_t -> xplane_rref_subscription_t
+static wmem_map_t* xplane_rref_unrequested;     // xplane_rref_key_t -> nstime_t, last value of an id with no captured request
+
+static guint xplane_rref_key_hash(gconstpointer key)
+{
+    const xplane_rref_key_t* rref_key = (const xplane_rref_key_t*)key;
+    return add_address_to_hash((rref_key->port << 16) ^ (guint)rref_key->id, &rref_key->client);
+}
+
+static gboolean xplane_rref_key_equal(gconstpointer a, gconstpointer b)
+{
+    const xplane_rref_key_t* key_a = (const xplane_rref_key_t*)a;
+    const xplane_rref_key_t* key_b = (const xplane_rref_key_t*)b;
+    return key_a->id == key_b->id && key_a->port == key_b->port && addresses_equal(&key_a->client, &key_b->client);
+}
+
+static xplane_rref_subscription_t* xplane_rref_lookup(const address* client, guint32 port, gint32 id)
+{
+    // The lookup key only borrows the address, it is never stored.
+    xplane_rref_key_t key;
+    key.client = *client;
+    key.port = port;
+    key.id = id;
+    return (xplane_rref_subscription_t*)wmem_map_lookup(xplane_rref_subscriptions, &key);
+}
+
+static xplane_rref_subscription_t* xplane_rref_lookup_or_add(const address* client, guint32 port, gint32 id)
+{
+    xplane_rref_subscription_t* subscription = xplane_rref_lookup(client, port, id);
+    if (subscription == NULL)
+    {
+        xplane_rref_key_t* key = wmem_new(wmem_file_scope(), xplane_rref_key_t);
+        copy_address_wmem(wmem_file_scope(), &key->client, client);
+        key->port = port;
+        key->id = id;
+
+        subscription = wmem_new0(wmem_file_scope(), xplane_rref_subscription_t);
+        subscription->bindings = wmem_array_new(wmem_file_scope(), sizeof(xplane_rref_binding_t));
+        // Values may already be arriving when the capture catches a repeated request.
+        const nstime_t* last = (const nstime_t*)wmem_map_remove(xplane_rref_unrequested, key);
+        if (last != NULL)
+            subscription->last_value_time = *last;
+        else
+            nstime_set_unset(&subscription->last_value_time);
+        wmem_map_insert(xplane_rref_subscriptions, key, subscription);
+    }
+    return subscription;
+}
+
+/*
+   The time of the previous value of an id, updated by the caller. Values whose
+   request is not in the capture get no subscription, only this time, so the
+   subscription table holds nothing that was never requested.
+*/
+static nstime_t* xplane_rref_last_value_time(xplane_rref_subscription_t* subscription, const address* client, guint32 port, gint32 id)
+{
+    if (subscription != NULL)
+        return &subscription->last_value_time;
+
+    xplane_rref_key_t key;
+    key.client = *client;
+    key.port = port;
+    key.id = id;
+    nstime_t* last = (nstime_t*)wmem_map_lookup(xplane_rref_unrequested, &key);
+    if (last == NULL)
+    {
+        xplane_rref_key_t* stored = wmem_new(wmem_file_scope(), xplane_rref_key_t);
+        copy_address_wmem(wmem_file_scope(), &stored->client, client);
+        stored->port = port;
+        stored->id = id;
+
+        last = wmem_new(wmem_file_scope(), nstime_t);
+        nstime_set_unset(last);
+        wmem_map_insert(xplane_rref_unrequested, stored, last);
+    }
+    return last;
+}
+
+// Requests that repeat the current dataref and frequency don't add to the history.
+static void xplane_rref_bind(xplane_rref_subscription_t* subscription, guint32 frame, const nstime_t* time, guint32 dataref, gint32 frequency)
+{
+    guint count = wmem_array_get_count(subscription->bindings);
+    if (count > 0)
+    {
+        const xplane_rref_binding_t* last = (const xplane_rref_binding_t*)wmem_array_index(subscription->bindings, count - 1);
+        // Unsubscribes often leave the dataref blank.
+        if (dataref == xplane_STRING_NONE)
+            dataref = last->dataref;
+        if (last->frequency == frequency && last->dataref == dataref)
+            return;
+    }
+
+    xplane_rref_binding_t binding = { 0 };
+    binding.first_frame = frame;
+    binding.request_time = *time;
+    binding.frequency = frequency;
+    binding.dataref = dataref;
+    wmem_array_append_one(subscription->bindings, binding);
+}
+
+// The binding in force at a frame, or NULL if the id had not been requested yet.
+static xplane_rref_binding_t* xplane_rref_binding_at(const xplane_rref_subscription_t* subscription, guint32 frame)
+{
+    xplane_rref_binding_t* bindings = (xplane_rref_binding_t*)wmem_array_get_raw(subscription->bindings);
+    guint low = 0;
+    guint high = wmem_array_get_count(subscription->bindings);
+
+    while (low < high)
+    {
+        guint mid = low + (high - low) / 2;
+        if (bindings[mid].first_frame <= frame)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low > 0 ? &bindings[low - 1] : NULL;
+}
+
 static int dissect_xplane_rref_in(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
 {
     const guint8* rref = NULL;
@@ -2413,20 +3387,121 @@ static int dissect_xplane_rref_in(tvbuff_t* tvb, packet_info* pinfo, proto_tree*
     tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
     proto_tree_add_item_ret_int(xplane_rref_tree, hf_xplane_rref_in_frequency, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &frequency);
     proto_tree_add_item_ret_int(xplane_rref_tree, hf_xplane_rref_in_id, tvb_content, 4, 4, ENC_LITTLE_ENDIAN, &id);
-    proto_tree_add_item_ret_string(xplane_rref_tree, hf_xplane_rref_in_dataref, tvb_content, 8, 400, ENC_ASCII, wmem_file_scope(), &rref);
+    proto_tree_add_item_ret_string(xplane_rref_tree, hf_xplane_rref_in_dataref, tvb_content, 8, 400, ENC_ASCII, wmem_packet_scope(), &rref);
 
     col_append_fstr(pinfo->cinfo, COL_INFO, " Id=%d, Freq=%d, RRef=%s", id, frequency, rref);
 
-    conversation_t* conv = conversation_new_by_id(pinfo->num, ENDPOINT_UDP, id);
-    conversation_add_proto_data(conv, proto_xplane, (void*)rref);
+    gint element;
+    const xplane_dataref_info_t* info = xplane_dataref_lookup((const char*)rref, &element);
+    if (info != NULL)
+        xplane_dataref_add_info(xplane_rref_tree, pinfo, tvb_content, 8, 400, info, element, FALSE, 0.0f);
+
+    // Only new names are copied, repeated requests just find their id.
+    guint32 dataref = xplane_STRING_NONE;
+    gboolean tapping = have_tap_listener(xplane_rref_tap);
+    if (!PINFO_FD_VISITED(pinfo) || tapping)
+        dataref = xplane_string_intern((const char*)rref);
+
+    if (!PINFO_FD_VISITED(pinfo))
+    {
+        xplane_rref_bind(xplane_rref_lookup_or_add(&pinfo->src, pinfo->srcport, id), pinfo->num, &pinfo->abs_ts, dataref, frequency);
+    }
+    else if (tree != NULL)
+    {
+        xplane_rref_subscription_t* subscription = xplane_rref_lookup(&pinfo->src, pinfo->srcport, id);
+        const xplane_rref_binding_t* binding = subscription != NULL ? xplane_rref_binding_at(subscription, pinfo->num) : NULL;
+        if (binding != NULL && binding->first_frame == pinfo->num && binding->first_value_frame != 0)
+        {
+            proto_item* response_item = proto_tree_add_uint(xplane_rref_tree, hf_xplane_rref_in_response, tvb_content, 4, 4, binding->first_value_frame);
+            proto_item_set_generated(response_item);
+        }
+    }
+
+    if (tapping)
+    {
+        xplane_rref_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_rref_tap_info_t);
+        tap_info->request = TRUE;
+        tap_info->client = &pinfo->src;
+        tap_info->port = pinfo->srcport;
+        tap_info->id = id;
+        tap_info->frequency = frequency;
+        tap_info->dataref = xplane_string(dataref);
+        tap_info->dataref_id = dataref;
+        tap_queue_packet(xplane_rref_tap, pinfo, tap_info);
+    }
 
     return tvb_captured_length(tvb);
 }
 
+static int* const xplane_rref_out_summary_fields[] =
+{
+    &hf_xplane_rref_out_id, &hf_xplane_rref_out_value
+};
+
+// A value past the record budget: the fields something uses, hidden, and the unsubscribed expert item.
+static void xplane_rref_out_add_filtered(proto_tree* tree, packet_info* pinfo, tvbuff_t* tvb, const xplane_rref_value_t* value, nstime_t delta, guint offset)
+{
+    proto_item* value_item = NULL;
+
+    xplane_record_add_filtered(tree, hf_xplane_rref_out_id, tvb, offset, 4, ENC_LITTLE_ENDIAN);
+    if (value->frequency == 0 || xplane_field_is_filtered(hf_xplane_rref_out_value))
+    {
+        value_item = proto_tree_add_float(tree, hf_xplane_rref_out_value, tvb, offset + 4, 4, value->value);
+        proto_item_set_hidden(value_item);
+    }
+    if (value->delta >= 0 && xplane_field_is_filtered(hf_xplane_rref_out_delta))
+        proto_item_set_hidden(proto_tree_add_time(tree, hf_xplane_rref_out_delta, tvb, offset, 4, &delta));
+    if (value->dataref != NULL && xplane_field_is_filtered(hf_xplane_rref_out_dataref))
+        proto_item_set_hidden(proto_tree_add_string(tree, hf_xplane_rref_out_dataref, tvb, offset, 4, value->dataref));
+    if (value->latency != NULL && xplane_field_is_filtered(hf_xplane_rref_out_latency))
+        proto_item_set_hidden(proto_tree_add_time(tree, hf_xplane_rref_out_latency, tvb, offset, 4, value->latency));
+
+    if (value->dataref != NULL && value->frequency == 0)
+        expert_add_info_format(pinfo, value_item, &ei_xplane_rref_out_unsubscribed, "Value for Id %d arrived after it was unsubscribed in frame %u", value->id, value->request_frame);
+}
+
+/*
+   Finds the binding in force for each value, whose id is already set, and on the
+   first pass records its time since the id's previous value in deltas.
+   Values are sent back to the client that made the request.
+*/
+static void xplane_rref_out_map_values(packet_info* pinfo, xplane_rref_value_t* values, guint count, nstime_t* deltas, gboolean first_pass, gboolean matching)
+{
+    for (guint i = 0; i < count; i++)
+    {
+        xplane_rref_value_t* value = &values[i];
+        xplane_rref_subscription_t* subscription = xplane_rref_lookup(&pinfo->dst, pinfo->destport, value->id);
+        if (first_pass)
+        {
+            nstime_t* last = xplane_rref_last_value_time(subscription, &pinfo->dst, pinfo->destport, value->id);
+            if (nstime_is_unset(last))
+                nstime_set_unset(&deltas[i]);
+            else
+                nstime_delta(&deltas[i], &pinfo->abs_ts, last);
+            *last = pinfo->abs_ts;
+        }
+        value->delta = (deltas != NULL && !nstime_is_unset(&deltas[i])) ? nstime_to_sec(&deltas[i]) : -1.0;
+
+        xplane_rref_binding_t* binding = subscription != NULL ? xplane_rref_binding_at(subscription, pinfo->num) : NULL;
+        if (first_pass && binding != NULL && binding->frequency > 0 && binding->first_value_frame == 0)
+        {
+            binding->first_value_frame = pinfo->num;
+            nstime_delta(&binding->latency, &pinfo->abs_ts, &binding->request_time);
+        }
+        value->latency = (binding != NULL && binding->first_value_frame == pinfo->num) ? &binding->latency : NULL;
+        if (matching && binding != NULL)
+            xplane_actions_match_rref(pinfo, binding->dataref, value->value);
+        value->dataref_id = binding != NULL ? binding->dataref : xplane_STRING_NONE;
+        value->dataref = binding != NULL ? xplane_string(binding->dataref) : NULL;
+        value->frequency = binding != NULL ? binding->frequency : -1;
+        value->request_frame = binding != NULL ? binding->first_frame : 0;
+    }
+}
+
 static int dissect_xplane_rref_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
 {
     guint length = tvb_captured_length(tvb);
-    guint recordCount = (length - 5) / 8;
+    guint recordCount = (length - 5) / xplane_RREF_OUT_STRUCT_LENGTH;
 
     proto_item* xplane_rref_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
     proto_item_append_text(xplane_rref_item, " Length=%u bytes. Count=%u", length, recordCount);
@@ -2434,20 +3509,109 @@ static int dissect_xplane_rref_out(tvbuff_t* tvb, packet_info* pinfo, proto_tree
     proto_tree* xplane_rref_tree = proto_item_add_subtree(xplane_rref_item, ett_xplane_rref_out);
     proto_tree_add_item(xplane_rref_tree, hf_xplane_rref_out_header, tvb, 0, 4, ENC_ASCII);
 
+    col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%d", recordCount);
+
+    // Without a tree or a tap listener only the column text is needed, once the inter-arrival times are known.
+    gboolean tapping = have_tap_listener(xplane_rref_tap);
+    gboolean first_pass = !PINFO_FD_VISITED(pinfo);
+    if (tree == NULL && !tapping && !first_pass)
+        return tvb_captured_length(tvb);
+
+    gboolean matching = xplane_actions_pending(pinfo);
+    nstime_t* deltas = NULL;
+    if (first_pass)
+    {
+        deltas = wmem_alloc_array(wmem_file_scope(), nstime_t, recordCount);
+        p_add_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_RREF_DELTAS, deltas);
+    }
+    else
+    {
+        deltas = (nstime_t*)p_get_proto_data(wmem_file_scope(), pinfo, proto_xplane, xplane_PROTO_DATA_RREF_DELTAS);
+    }
+
     tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+    xplane_rref_value_t* values = wmem_alloc_array(wmem_packet_scope(), xplane_rref_value_t, recordCount);
     for (guint32 i = 0; i < recordCount; i++)
     {
-        int32_t id = tvb_get_int32(tvb_content, 8 * i, ENC_LITTLE_ENDIAN);
-        proto_tree* xplane_content_tree = proto_tree_add_subtree_format(xplane_rref_tree, tvb_content, 8 * i, 8, ett_xplane_rref_out, NULL, "RREF Id: %d", id);
-        proto_tree_add_item(xplane_content_tree, hf_xplane_rref_out_id, tvb_content, 8 * i, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_content_tree, hf_xplane_rref_out_value, tvb_content, (8 * i) + 4, 4, ENC_LITTLE_ENDIAN);
+        values[i].id = tvb_get_int32(tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, ENC_LITTLE_ENDIAN);
+        values[i].value = tvb_get_ieee_float(tvb_content, (xplane_RREF_OUT_STRUCT_LENGTH * i) + 4, ENC_LITTLE_ENDIAN);
+    }
+    xplane_rref_out_map_values(pinfo, values, recordCount, deltas, first_pass, matching);
 
-        conversation_t* conv = find_conversation_by_id(pinfo->num, ENDPOINT_UDP, id);
-        if (conv != NULL)
-            proto_item_append_text(xplane_content_tree, " : %s", (gchar*)conversation_get_proto_data(conv, proto_xplane));
+    xplane_action_add_effects(xplane_rref_tree, pinfo, tvb);
+
+    if (tapping)
+    {
+        xplane_rref_tap_info_t* tap_info = wmem_new0(wmem_packet_scope(), xplane_rref_tap_info_t);
+        tap_info->client = &pinfo->dst;
+        tap_info->port = pinfo->destport;
+        tap_info->count = recordCount;
+        tap_info->values = values;
+        tap_queue_packet(xplane_rref_tap, pinfo, tap_info);
     }
 
-    col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%d", recordCount);
+    if (tree == NULL)
+        return tvb_captured_length(tvb);
+
+    xplane_record_summary_t summary;
+    xplane_summary_init(&summary, xplane_rref_out_summary_fields, array_length(xplane_rref_out_summary_fields));
+
+    for (guint32 i = 0; i < recordCount; i++)
+    {
+        const xplane_rref_value_t* value = &values[i];
+        // deltas is NULL if the first pass never stored it, and value->delta is then < 0 as well.
+        nstime_t delta;
+        if (deltas != NULL)
+            delta = deltas[i];
+        else
+            nstime_set_unset(&delta);
+
+        if (!xplane_record_is_expanded(i))
+        {
+            summary.count++;
+            xplane_summary_add_value(&summary, 0, value->id);
+            xplane_summary_add_value(&summary, 1, value->value);
+            xplane_rref_out_add_filtered(xplane_rref_tree, pinfo, tvb_content, value, delta, xplane_RREF_OUT_STRUCT_LENGTH * i);
+            continue;
+        }
+
+        proto_tree* xplane_content_tree = proto_tree_add_subtree_format(xplane_rref_tree, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, xplane_RREF_OUT_STRUCT_LENGTH, ett_xplane_rref_out, NULL, "RREF Id: %d", value->id);
+        proto_tree_add_int(xplane_content_tree, hf_xplane_rref_out_id, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, 4, value->id);
+        proto_item* value_item = proto_tree_add_float(xplane_content_tree, hf_xplane_rref_out_value, tvb_content, (xplane_RREF_OUT_STRUCT_LENGTH * i) + 4, 4, value->value);
+
+        if (value->delta >= 0)
+        {
+            proto_item* delta_item = proto_tree_add_time(xplane_content_tree, hf_xplane_rref_out_delta, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, 4, &delta);
+            proto_item_set_generated(delta_item);
+        }
+
+        if (value->dataref != NULL)
+        {
+            proto_item_append_text(xplane_content_tree, " : %s", value->dataref);
+            proto_item* dataref_item = proto_tree_add_string(xplane_content_tree, hf_xplane_rref_out_dataref, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, 4, value->dataref);
+            proto_item_set_generated(dataref_item);
+            proto_item* request_item = proto_tree_add_uint(xplane_content_tree, hf_xplane_rref_out_idlink, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, 4, value->request_frame);
+            proto_item_set_generated(request_item);
+            if (value->latency != NULL)
+            {
+                proto_item* latency_item = proto_tree_add_time(xplane_content_tree, hf_xplane_rref_out_latency, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * i, 4, value->latency);
+                proto_item_set_generated(latency_item);
+            }
+
+            const xplane_dataref_info_t* info = xplane_dataref_lookup_id(value->dataref_id);
+            if (info != NULL)
+            {
+                if (info->units[0] != '\0')
+                    proto_item_append_text(value_item, " %s", info->units);
+                xplane_dataref_add_info(xplane_content_tree, pinfo, tvb_content, (xplane_RREF_OUT_STRUCT_LENGTH * i) + 4, 4, info, -1, TRUE, value->value);
+            }
+
+            if (value->frequency == 0)
+                expert_add_info_format(pinfo, value_item, &ei_xplane_rref_out_unsubscribed, "Value for Id %d arrived after it was unsubscribed in frame %u", value->id, value->request_frame);
+        }
+    }
+
+    xplane_summary_add_tree(xplane_rref_tree, tvb_content, xplane_RREF_OUT_STRUCT_LENGTH * xplane_pref_max_records, &summary);
 
     return tvb_captured_length(tvb);
 }
@@ -2491,71 +3655,34 @@ static int dissect_xplane_simo(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tr
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_soun(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_soun_fields[] =
 {
-    const guint8* filename = NULL;
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_soun_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_soun_item, " Length=%u bytes.", length);
-
-    proto_tree* xplane_soun_tree = proto_item_add_subtree(xplane_soun_item, ett_xplane_soun);
-    proto_tree_add_item(xplane_soun_tree, hf_xplane_soun_header, tvb, 0, 4, ENC_ASCII);
-
-    tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-    proto_tree_add_item(xplane_soun_tree, hf_xplane_soun_frequency, tvb_content, 0, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item(xplane_soun_tree, hf_xplane_soun_volume, tvb_content, 4, 4, ENC_LITTLE_ENDIAN);
-    proto_tree_add_item_ret_string(xplane_soun_tree, hf_xplane_soun_filename, tvb_content, 8, -1, ENC_ASCII, wmem_packet_scope(), &filename);
-
-    col_append_fstr(pinfo->cinfo, COL_INFO, " Filename=%s", filename);
-
-    gfloat frequency = tvb_get_ieee_float(tvb_content, 0, ENC_LITTLE_ENDIAN);
-    gfloat volume = tvb_get_ieee_float(tvb_content, 4, ENC_LITTLE_ENDIAN);
+    { &hf_xplane_soun_frequency, 0, 4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_soun_frequency, "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_soun_volume,    4, 4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_soun_volume,    "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_soun_filename,  8, -1, xplane_FIELD_STRING, "Filename", xplane_CHECK_NONE,  0, 0, NULL,                      NULL }
+};
 
-    if (frequency < 0.0 || frequency > 1.0)
-        expert_add_info_format(pinfo, xplane_soun_item, &ei_xplane_soun_frequency, "Possible invalid frequency [%lf]. Values should be between 0.0 and 1.0.", frequency);
-    if (volume < 0.0 || volume > 1.0)
-        expert_add_info_format(pinfo, xplane_soun_item, &ei_xplane_soun_volume, "Possible invalid volume [%lf]. Values should be between 0 and 1.0.", volume);
-    if (length != xplane_SOUN_PACKET_LENGTH)
-        expert_add_info_format(pinfo, xplane_soun_item, &ei_xplane_soun_length, "Length %u is invalid. Expected length %u", length, xplane_SOUN_PACKET_LENGTH);
+static const xplane_message_layout_t xplane_soun_layout = { xplane_SOUN_PACKET_LENGTH, &ett_xplane_soun, &hf_xplane_soun_header, &ei_xplane_soun_length, NULL, xplane_soun_fields, array_length(xplane_soun_fields) };
 
+static int dissect_xplane_soun(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    dissect_xplane_layout(tvb, pinfo, tree, &xplane_soun_layout, NULL);
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_ssnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_ssnd_fields[] =
 {
-    gint32 index = 0;
-    const guint8* filename = NULL;
-    guint length = tvb_captured_length(tvb);
-
-    proto_item* xplane_ssnd_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_ssnd_item, " Length=%u bytes.", length);
-
-    proto_tree* xplane_ssnd_tree = proto_item_add_subtree(xplane_ssnd_item, ett_xplane_ssnd);
-    proto_tree_add_item(xplane_ssnd_tree, hf_xplane_ssnd_header, tvb, 0, 4, ENC_ASCII);
-
-    if (length != xplane_SSND_PACKET_LENGTH)
-        expert_add_info_format(pinfo, xplane_ssnd_item, &ei_xplane_ssnd_length, "Length %u is invalid. Expected length %u", length, xplane_SSND_PACKET_LENGTH);
-    else
-    {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
-        proto_tree_add_item_ret_int(xplane_ssnd_tree, hf_xplane_ssnd_index, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &index);
-        proto_tree_add_item(xplane_ssnd_tree, hf_xplane_ssnd_speed, tvb_content, 4, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item(xplane_ssnd_tree, hf_xplane_ssnd_volume, tvb_content, 8, 4, ENC_LITTLE_ENDIAN);
-        proto_tree_add_item_ret_string(xplane_ssnd_tree, hf_xplane_ssnd_filename, tvb_content, 12, -1, ENC_ASCII, wmem_packet_scope(), &filename);
-
-        col_append_fstr(pinfo->cinfo, COL_INFO, " Index=%d Filename=%s", index, filename);
+    { &hf_xplane_ssnd_index,    0,  4,  xplane_FIELD_INT32,  "Index",    xplane_CHECK_RANGE, 0, 4, &ei_xplane_ssnd_index,     "might not be valid. Valid values are 0->4." },
+    { &hf_xplane_ssnd_speed,    4,  4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_ssnd_frequency, "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_ssnd_volume,   8,  4,  xplane_FIELD_FLOAT,  NULL,       xplane_CHECK_RANGE, 0, 1, &ei_xplane_ssnd_volume,    "might not be valid. Values should be between 0.0 and 1.0." },
+    { &hf_xplane_ssnd_filename, 12, -1, xplane_FIELD_STRING, "Filename", xplane_CHECK_NONE,  0, 0, NULL,                      NULL }
+};
 
-        gfloat frequency = tvb_get_ieee_float(tvb_content, 4, ENC_LITTLE_ENDIAN);
-        gfloat volume = tvb_get_ieee_float(tvb_content, 8, ENC_LITTLE_ENDIAN);
+static const xplane_message_layout_t xplane_ssnd_layout = { xplane_SSND_PACKET_LENGTH, &ett_xplane_ssnd, &hf_xplane_ssnd_header, &ei_xplane_ssnd_length, NULL, xplane_ssnd_fields, array_length(xplane_ssnd_fields) };
 
-        if (index < 0 || index > 4)
-            expert_add_info_format(pinfo, xplane_ssnd_item, &ei_xplane_ssnd_index, "Possible invalid index %u. Valid values are 0->4.", index);
-        if (frequency < 0.0 || frequency > 1.0)
-            expert_add_info_format(pinfo, xplane_ssnd_item, &ei_xplane_ssnd_frequency, "Possible invalid frequency [%lf]. Values should be between 0.0 and 1.0.", frequency);
-        if (volume < 0.0 || volume > 1.0)
-            expert_add_info_format(pinfo, xplane_ssnd_item, &ei_xplane_ssnd_volume, "Possible invalid volume [%lf]. Values should be between 0 and 1.0.", volume);
-    }
+static int dissect_xplane_ssnd(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    dissect_xplane_layout(tvb, pinfo, tree, &xplane_ssnd_layout, NULL);
     return tvb_captured_length(tvb);
 }
 
@@ -2579,13 +3706,11 @@ static int dissect_xplane_ucoc(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree
         guint recordCount = tvb_captured_length(tvb_content) / xplane_DATA_INDEX_LENGTH;
         proto_item_append_text(xplane_ucoc_item, " Count=%u", recordCount);
         col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
-        for (guint32 i = 0; i < recordCount; i++)
-        {
-            gint id;
-            proto_item* item = proto_tree_add_item_ret_int(xplane_ucoc_tree, hf_xplane_ucoc_id, tvb_content, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, ENC_LITTLE_ENDIAN, &id);
-            if (id < 0 || id > 255)
-                expert_add_info_format(pinfo, item, &ei_xplane_ucoc_id, "Id %u is invalid.", id);
-        }
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        xplane_add_index_list(xplane_ucoc_tree, pinfo, tvb_content, recordCount, &hf_xplane_ucoc_id, &ei_xplane_ucoc_id);
     }
     return tvb_captured_length(tvb);
 }
@@ -2610,105 +3735,139 @@ static int dissect_xplane_usel(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree
         guint recordCount = tvb_captured_length(tvb_content) / xplane_DATA_INDEX_LENGTH;
         proto_item_append_text(xplane_usel_item, " Count=%u", recordCount);
         col_append_fstr(pinfo->cinfo, COL_INFO, " Count=%u", recordCount);
-        for (guint32 i = 0; i < recordCount; i++)
-        {
-            gint id;
-            proto_item* item = proto_tree_add_item_ret_int(xplane_usel_tree, hf_xplane_usel_id, tvb_content, i * xplane_DATA_INDEX_LENGTH, xplane_DATA_INDEX_LENGTH, ENC_LITTLE_ENDIAN, &id);
-            if (id < 0 || id > 255)
-                expert_add_info_format(pinfo, item, &ei_xplane_usel_id, "Id %u is invalid.", id);
-        }
+
+        if (tree == NULL)
+            return tvb_captured_length(tvb);
+
+        xplane_add_index_list(xplane_usel_tree, pinfo, tvb_content, recordCount, &hf_xplane_usel_id, &ei_xplane_usel_id);
     }
     return tvb_captured_length(tvb);
 }
 
-static int dissect_xplane_vehx(tvbuff_t* tvb, packet_info* pinfo _U_, proto_tree* tree, void* data _U_)
+static const xplane_field_layout_t xplane_vehx_fields[] =
 {
-    guint length = tvb_captured_length(tvb);
+    { &hf_xplane_vehx_id,        0,  4, xplane_FIELD_INT32,  NULL, xplane_CHECK_RANGE, 0,    19,  &ei_xplane_vehx_id,        "must be either 0 (own Aircraft) or 1->19 (AI Aircraft)." },
+    { &hf_xplane_vehx_latitude,  4,  8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -90,  90,  &ei_xplane_vehx_latitude,  "must be between -90 and +90." },
+    { &hf_xplane_vehx_longitude, 12, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_RANGE, -180, 180, &ei_xplane_vehx_longitude, "must be between -180 and +180." },
+    { &hf_xplane_vehx_elevation, 20, 8, xplane_FIELD_DOUBLE, NULL, xplane_CHECK_MIN,   0,    0,   &ei_xplane_vehx_elevation, "might not be valid." },
+    { &hf_xplane_vehx_heading,   28, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_vehx_heading,   "might not be valid." },
+    { &hf_xplane_vehx_pitch,     32, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_vehx_pitch,     "might not be valid." },
+    { &hf_xplane_vehx_roll,      36, 4, xplane_FIELD_FLOAT,  NULL, xplane_CHECK_RANGE, 0,    360, &ei_xplane_vehx_roll,      "might not be valid." }
+};
 
-    proto_item* xplane_vehx_item = proto_tree_add_item(tree, proto_xplane, tvb, 0, -1, ENC_NA);
-    proto_item_append_text(xplane_vehx_item, " Length=%u bytes.", length);
+static const xplane_message_layout_t xplane_vehx_layout = { xplane_VEHX_PACKET_LENGTH, &ett_xplane_vehx, &hf_xplane_vehx_header, &ei_xplane_vehx_length, NULL, xplane_vehx_fields, array_length(xplane_vehx_fields) };
 
-    proto_tree* xplane_vehx_tree = proto_item_add_subtree(xplane_vehx_item, ett_xplane_vehx);
-    proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_header, tvb, 0, 4, ENC_ASCII);
+static int dissect_xplane_vehx(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
+{
+    xplane_field_value_t values[array_length(xplane_vehx_fields)];
+    proto_tree* xplane_vehx_tree = dissect_xplane_layout(tvb, pinfo, tree, &xplane_vehx_layout, xplane_position_values_wanted(pinfo) ? values : NULL);
+    if (tvb_captured_length(tvb) != xplane_VEHX_PACKET_LENGTH)
+        return tvb_captured_length(tvb);
 
-    if (length != xplane_VEHX_PACKET_LENGTH)
+    if (!PINFO_FD_VISITED(pinfo))
     {
-        expert_add_info_format(pinfo, xplane_vehx_item, &ei_xplane_vehx_length, "Length %u is invalid. Expected length %u", length, xplane_VEHX_PACKET_LENGTH);
+        gint slot = xplane_slot_index(values[0].i, FALSE);
+        xplane_slot_table_t* slots = xplane_slot_enter(pinfo, slot, values[1].d, values[2].d);
+        if (slots != NULL)
+            xplane_slot_move(slots, slot, pinfo, values[1].d, values[2].d, values[3].d, values[4].d, values[5].d, values[6].d);
+        xplane_action_new_move(pinfo, xplane_ACTION_VEHX, values[0].i, TRUE, values[1].d, values[2].d);
     }
-    else
+    if (xplane_position_values_wanted(pinfo))
+        xplane_position_tap_queue(pinfo, &pinfo->dst, values[0].i, FALSE, TRUE, values[1].d, values[2].d, values[3].d, values[4].d, values[5].d, values[6].d);
+    xplane_slot_add_tree(xplane_vehx_tree, pinfo, tvb);
+    xplane_action_add_tree(xplane_vehx_tree, pinfo, tvb);
+    return tvb_captured_length(tvb);
+}
+
+// ---------- Message Dispatch ----------
+#define xplane_FOURCC(a, b, c, d) (((guint32)(a) << 24) | ((guint32)(b) << 16) | ((guint32)(c) << 8) | (guint32)(d))
+
+typedef struct xplane_message
+{
+    guint32 fourcc;                 /* Upper-case header as a big-endian 32-bit value. */
+    const char* col_protocol;       /* Precomputed COL_PROTOCOL text. */
+    const char* col_info;           /* Precomputed initial COL_INFO text. */
+    dissector_t dissector;          /* Handler for single direction messages, or the "out" (from X-Plane) variant. */
+    dissector_t dissector_in;       /* Handler for the "in" (to X-Plane) variant, NULL if there is only one. */
+    guint in_below_length;          /* Packets shorter than this are the "in" variant. */
+    guint in_exact_length;          /* Packets of exactly this length are the "in" variant. */
+    guint out_exact_length;         /* If non-zero the "out" variant is only accepted at exactly this length. */
+    guint heur_fixed_length;        /* Heuristic only: exact length of a well formed packet, 0 if variable. */
+    guint heur_record_length;       /* Heuristic only: length-5 must be a multiple of this, 0 if not record based. */
+    guint heur_min_length;          /* Heuristic only: shortest well formed variable length packet, 0 if not checked. */
+    const char* heur_markers;       /* Heuristic only: 5th bytes other than '\0' the simulator sends, NULL if none. */
+} xplane_message_t;
+
+/* Must remain sorted by fourcc as it is binary searched. */
+static const xplane_message_t xplane_messages[] =
+{
+    { xplane_FOURCC('A','C','F','N'), "xplane.acfn", "X-Plane (ACFN)", dissect_xplane_acfn,     NULL,                   0,  0,                            0,                             xplane_ACFN_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('A','C','P','R'), "xplane.acpr", "X-Plane (ACPR)", dissect_xplane_acpr,     NULL,                   0,  0,                            0,                             xplane_ACPR_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('A','L','R','T'), "xplane.alrt", "X-Plane (ALRT)", dissect_xplane_alrt,     NULL,                   0,  0,                            0,                             xplane_ALRT_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('B','E','C','N'), "xplane.becn", "X-Plane (BECN)", dissect_xplane_becn,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_BECN_MIN_LENGTH,   NULL },
+    { xplane_FOURCC('C','M','N','D'), "xplane.cmnd", "X-Plane (CMND)", dissect_xplane_cmnd,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_STRING_MIN_LENGTH, NULL },
+    { xplane_FOURCC('D','A','T','A'), "xplane.data", "X-Plane (DATA)", dissect_xplane_data,     NULL,                   0,  0,                            0,                             0,                             xplane_DATA_STRUCT_LENGTH,     0,                        "*@" },
+    { xplane_FOURCC('D','C','O','C'), "xplane.dcoc", "X-Plane (DCOC)", dissect_xplane_dcoc,     NULL,                   0,  0,                            0,                             0,                             xplane_DATA_INDEX_LENGTH,      0,                        NULL },
+    { xplane_FOURCC('D','R','E','F'), "xplane.dref", "X-Plane (DREF)", dissect_xplane_dref,     NULL,                   0,  0,                            0,                             xplane_DREF_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('D','S','E','L'), "xplane.dsel", "X-Plane (DSEL)", dissect_xplane_dsel,     NULL,                   0,  0,                            0,                             0,                             xplane_DATA_INDEX_LENGTH,      0,                        NULL },
+    { xplane_FOURCC('F','A','I','L'), "xplane.fail", "X-Plane (FAIL)", dissect_xplane_fail,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_STRING_MIN_LENGTH, NULL },
+    { xplane_FOURCC('F','L','I','R'), "xplane.flir", "X-Plane (FLIR)", dissect_xplane_flir_out, dissect_xplane_flir_in, 20, 0,                            0,                             0,                             0,                             0,                        NULL },
+    { xplane_FOURCC('I','S','E','4'), "xplane.ise4", "X-Plane (ISE4)", dissect_xplane_ise4,     NULL,                   0,  0,                            0,                             xplane_ISE4_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('I','S','E','6'), "xplane.ise6", "X-Plane (ISE6)", dissect_xplane_ise6,     NULL,                   0,  0,                            0,                             xplane_ISE6_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('L','S','N','D'), "xplane.lsnd", "X-Plane (LSND)", dissect_xplane_lsnd,     NULL,                   0,  0,                            0,                             xplane_LSND_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('N','F','A','L'), "xplane.nfal", "X-Plane (NFAL)", dissect_xplane_nfal,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_STRING_MIN_LENGTH, NULL },
+    { xplane_FOURCC('N','R','E','C'), "xplane.nrec", "X-Plane (NREC)", dissect_xplane_nrec,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_STRING_MIN_LENGTH, NULL },
+    { xplane_FOURCC('O','B','J','L'), "xplane.objl", "X-Plane (OBJL)", dissect_xplane_objl,     NULL,                   0,  0,                            0,                             xplane_OBJL_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('O','B','J','N'), "xplane.objn", "X-Plane (OBJN)", dissect_xplane_objn,     NULL,                   0,  0,                            0,                             xplane_OBJN_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('P','R','E','L'), "xplane.prel", "X-Plane (PREL)", dissect_xplane_prel,     NULL,                   0,  0,                            0,                             xplane_PREL_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('Q','U','I','T'), "xplane.quit", "X-Plane (QUIT)", dissect_xplane_quit,     NULL,                   0,  0,                            0,                             xplane_QUIT_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('R','A','D','R'), "xplane.radr", "X-Plane (RADR)", dissect_xplane_radr_out, dissect_xplane_radr_in, 10, 0,                            0,                             0,                             xplane_RADR_OUT_STRUCT_LENGTH, 0,                        NULL },
+    { xplane_FOURCC('R','E','C','O'), "xplane.reco", "X-Plane (RECO)", dissect_xplane_reco,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_STRING_MIN_LENGTH, NULL },
+    { xplane_FOURCC('R','E','S','E'), "xplane.rese", "X-Plane (RESE)", dissect_xplane_rese,     NULL,                   0,  0,                            0,                             xplane_RESE_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('R','P','O','S'), "xplane.rpos", "X-Plane (RPOS)", dissect_xplane_rpos_out, dissect_xplane_rpos_in, 10, 0,                            xplane_RPOS_OUT_PACKET_LENGTH, xplane_RPOS_OUT_PACKET_LENGTH, 0,                             0,                        "4"  },
+    { xplane_FOURCC('R','R','E','F'), "xplane.rref", "X-Plane (RREF)", dissect_xplane_rref_out, dissect_xplane_rref_in, 0,  xplane_RREF_IN_PACKET_LENGTH, 0,                             0,                             xplane_RREF_OUT_STRUCT_LENGTH, 0,                        ","  },
+    { xplane_FOURCC('S','H','U','T'), "xplane.shut", "X-Plane (SHUT)", dissect_xplane_shut,     NULL,                   0,  0,                            0,                             xplane_SHUT_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('S','I','M','O'), "xplane.simo", "X-Plane (SIMO)", dissect_xplane_simo,     NULL,                   0,  0,                            0,                             0,                             0,                             xplane_SIMO_MIN_LENGTH,   NULL },
+    { xplane_FOURCC('S','O','U','N'), "xplane.soun", "X-Plane (SOUN)", dissect_xplane_soun,     NULL,                   0,  0,                            0,                             xplane_SOUN_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('S','S','N','D'), "xplane.ssnd", "X-Plane (SSND)", dissect_xplane_ssnd,     NULL,                   0,  0,                            0,                             xplane_SSND_PACKET_LENGTH,     0,                             0,                        NULL },
+    { xplane_FOURCC('U','C','O','C'), "xplane.ucoc", "X-Plane (UCOC)", dissect_xplane_ucoc,     NULL,                   0,  0,                            0,                             0,                             xplane_DATA_INDEX_LENGTH,      0,                        NULL },
+    { xplane_FOURCC('U','S','E','L'), "xplane.usel", "X-Plane (USEL)", dissect_xplane_usel,     NULL,                   0,  0,                            0,                             0,                             xplane_DATA_INDEX_LENGTH,      0,                        NULL },
+    { xplane_FOURCC('V','E','H','X'), "xplane.vehx", "X-Plane (VEHX)", dissect_xplane_vehx,     NULL,                   0,  0,                            0,                             xplane_VEHX_PACKET_LENGTH,     0,                             0,                        NULL }
+};
+
+static const xplane_message_t* xplane_find_message(tvbuff_t* tvb)
+{
+    // Headers are matched case insensitively so fold any a-z bytes to A-Z.
+    guint32 fourcc = tvb_get_ntohl(tvb, 0);
+    for (guint shift = 0; shift < 32; shift += 8)
     {
-        tvbuff_t* tvb_content = tvb_new_subset_length(tvb, xplane_HEADER_LENGTH, -1);
+        guint8 c = (guint8)(fourcc >> shift);
+        if (c >= 'a' && c <= 'z')
+            fourcc -= (guint32)0x20 << shift;
+    }
 
-        gint32 id = 0;
-        proto_item* id_item = proto_tree_add_item_ret_int(xplane_vehx_tree, hf_xplane_vehx_id, tvb_content, 0, 4, ENC_LITTLE_ENDIAN, &id);
-        proto_item* latitude_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_latitude, tvb_content, 4, 8, ENC_LITTLE_ENDIAN);
-        proto_item* longitude_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_longitude, tvb_content, 12, 8, ENC_LITTLE_ENDIAN);
-        proto_item* elevation_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_elevation, tvb_content, 20, 8, ENC_LITTLE_ENDIAN);
-        proto_item* heading_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_heading, tvb_content, 28, 4, ENC_LITTLE_ENDIAN);
-        proto_item* pitch_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_pitch, tvb_content, 32, 4, ENC_LITTLE_ENDIAN);
-        proto_item* roll_item = proto_tree_add_item(xplane_vehx_tree, hf_xplane_vehx_roll, tvb_content, 36, 4, ENC_LITTLE_ENDIAN);
-
-        gdouble latitude = tvb_get_ieee_double(tvb_content, 4, ENC_LITTLE_ENDIAN);
-        gdouble longitude = tvb_get_ieee_double(tvb_content, 12, ENC_LITTLE_ENDIAN);
-        gdouble elevation = tvb_get_ieee_double(tvb_content, 20, ENC_LITTLE_ENDIAN);
-        gfloat  heading = tvb_get_ieee_float(tvb_content, 28, ENC_LITTLE_ENDIAN);
-        gfloat  pitch = tvb_get_ieee_float(tvb_content, 32, ENC_LITTLE_ENDIAN);
-        gfloat  roll = tvb_get_ieee_float(tvb_content, 36, ENC_LITTLE_ENDIAN);
-
-        if (id < 0 || id > 19)
-            expert_add_info_format(pinfo, id_item, &ei_xplane_vehx_id, "The provided Id [%u] must be either 0 (own Aircraft) or 1->19 (AI Aircraft).", id);
-        if (latitude < -90 || latitude > 90)
-            expert_add_info_format(pinfo, latitude_item, &ei_xplane_vehx_latitude, "The provided Latitude [%lf] must be between -90 and +90.", latitude);
-        if (longitude < -180 || longitude > 180)
-            expert_add_info_format(pinfo, longitude_item, &ei_xplane_vehx_longitude, "The provided longitude [%lf] must be between -180 and +180.", longitude);
-        if (elevation < 0)
-            expert_add_info_format(pinfo, elevation_item, &ei_xplane_vehx_elevation, "The provided elevation [%lf] might not be valid.", elevation);
-        if (heading < 0 || heading > 360)
-            expert_add_info_format(pinfo, heading_item, &ei_xplane_vehx_heading, "The provided heading [%f] might not be valid.", heading);
-        if (pitch < 0 || pitch > 360)
-            expert_add_info_format(pinfo, pitch_item, &ei_xplane_vehx_pitch, "The provided pitch [%f] might not be valid.", pitch);
-        if (roll < 0 || roll > 360)
-            expert_add_info_format(pinfo, roll_item, &ei_xplane_vehx_roll, "The provided roll [%f] might not be valid.", roll);
+    guint low = 0;
+    guint high = array_length(xplane_messages);
+    while (low < high)
+    {
+        guint mid = (low + high) / 2;
+        if (xplane_messages[mid].fourcc < fourcc)
+            low = mid + 1;
+        else if (xplane_messages[mid].fourcc > fourcc)
+            high = mid;
+        else
+            return &xplane_messages[mid];
     }
-    return tvb_captured_length(tvb);
+    return NULL;
 }
 
-static gboolean validate_header(tvbuff_t* tvb)
-{
-    guint8* bytes = tvb_get_string_enc(wmem_packet_scope(), tvb, 0, 4, ENC_ASCII | ENC_NA);
-
-    return ((g_ascii_strncasecmp(bytes, "ACFN", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "ACPR", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "ALRT", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "BECN", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "CMND", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "DATA", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "DCOC", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "DREF", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "DSEL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "FAIL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "FLIR", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "ISE4", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "ISE6", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "LSND", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "NFAL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "NREC", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "OBJL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "OBJN", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "PREL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "QUIT", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "RADR", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "RECO", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "RESE", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "RPOS", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "RREF", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "SHUT", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "SIMO", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "SOUN", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "SSND", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "UCOC", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "USEL", 4) == 0) ||
-        (g_ascii_strncasecmp(bytes, "VEHX", 4) == 0));
+static dissector_t xplane_select_dissector(const xplane_message_t* message, guint length)
+{
+    if (message->dissector_in != NULL && (length < message->in_below_length || length == message->in_exact_length))
+        return message->dissector_in;
+    if (message->out_exact_length != 0 && length != message->out_exact_length)
+        return NULL;
+    return message->dissector;
 }
 
 static int dissect_xplane(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data _U_)
@@ -2717,105 +3876,73 @@ static int dissect_xplane(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, v
         return 0;
 
     // If we don't recognise the header don't process it.
-    if (!validate_header(tvb))
+    const xplane_message_t* message = xplane_find_message(tvb);
+    if (message == NULL)
         return 0;
 
-    guint8* bytes = tvb_get_string_enc(wmem_packet_scope(), tvb, 0, 4, ENC_ASCII | ENC_NA);
-    gchar* bytes_lower = wmem_ascii_strdown(wmem_packet_scope(), bytes, 4);
-
-    col_clear(pinfo->cinfo, COL_PROTOCOL);
-    col_add_fstr(pinfo->cinfo, COL_PROTOCOL, "xplane.%s", bytes_lower);
-    col_clear(pinfo->cinfo, COL_INFO);
-    col_add_fstr(pinfo->cinfo, COL_INFO, "X-Plane (%s)", bytes);
-
-    if (g_ascii_strncasecmp(bytes, "ACFN", 4) == 0)
-        return dissect_xplane_acfn(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "ACPR", 4) == 0)
-        return dissect_xplane_acpr(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "ALRT", 4) == 0)
-        return dissect_xplane_alrt(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "BECN", 4) == 0)
-        return dissect_xplane_becn(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "CMND", 4) == 0)
-        return dissect_xplane_cmnd(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "DATA", 4) == 0)
-        return dissect_xplane_data(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "DCOC", 4) == 0)
-        return dissect_xplane_dcoc(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "DREF", 4) == 0)
-        return dissect_xplane_dref(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "DSEL", 4) == 0)
-        return dissect_xplane_dsel(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "FAIL", 4) == 0)
-        return dissect_xplane_fail(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "FLIR", 4) == 0)
-    {
-        if (tvb_captured_length(tvb) < 20)
-            return dissect_xplane_flir_in(tvb, pinfo, tree, data);
-        else
-            return dissect_xplane_flir_out(tvb, pinfo, tree, data);
-    }
-    else if (g_ascii_strncasecmp(bytes, "ISE4", 4) == 0)
-        return dissect_xplane_ise4(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "ISE6", 4) == 0)
-        return dissect_xplane_ise6(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "LSND", 4) == 0)
-        return dissect_xplane_lsnd(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "NFAL", 4) == 0)
-        return dissect_xplane_nfal(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "NREC", 4) == 0)
-        return dissect_xplane_nrec(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "OBJL", 4) == 0)
-        return dissect_xplane_objl(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "OBJN", 4) == 0)
-        return dissect_xplane_objn(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "PREL", 4) == 0)
-        return dissect_xplane_prel(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "QUIT", 4) == 0)
-        return dissect_xplane_quit(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "RADR", 4) == 0)
-    {
-        if (tvb_captured_length(tvb) < 10)
-            return dissect_xplane_radr_in(tvb, pinfo, tree, data);
-        else
-            return dissect_xplane_radr_out(tvb, pinfo, tree, data);
-    }
-    else if (g_ascii_strncasecmp(bytes, "RECO", 4) == 0)
-        return dissect_xplane_reco(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "RESE", 4) == 0)
-        return dissect_xplane_rese(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "RPOS", 4) == 0)
-    {
-        if (tvb_captured_length(tvb) < 10)
-            return dissect_xplane_rpos_in(tvb, pinfo, tree, data);
-        else if (tvb_captured_length(tvb) == xplane_RPOS_OUT_PACKET_LENGTH)
-            return dissect_xplane_rpos_out(tvb, pinfo, tree, data);
-        else
-            return 0;
+    dissector_t dissector = xplane_select_dissector(message, tvb_captured_length(tvb));
+    if (dissector == NULL)
+        return 0;
+
+    col_set_str(pinfo->cinfo, COL_PROTOCOL, message->col_protocol);
+    col_set_str(pinfo->cinfo, COL_INFO, message->col_info);
+
+    return dissector(tvb, pinfo, tree, data);
+}
+
+// The "in" requests without a fixed length (FLIR, RADR and RPOS) carry a rate or count as '\0' terminated digits.
+static gboolean xplane_heur_is_number(tvbuff_t* tvb, guint length)
+{
+    if (length < xplane_MIN_PACKET_LENGTH + 2 || tvb_get_guint8(tvb, length - 1) != 0)
+        return FALSE;
+    for (guint offset = xplane_MIN_PACKET_LENGTH; offset < length - 1; offset++)
+    {
+        guint8 c = tvb_get_guint8(tvb, offset);
+        if (!g_ascii_isdigit(c) && c != '.')
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static gboolean dissect_xplane_heur(tvbuff_t* tvb, packet_info* pinfo, proto_tree* tree, void* data)
+{
+    // Everything here is decided from the header, the length and at most a short request's digits, without allocating.
+    guint length = tvb_captured_length(tvb);
+    if (length < xplane_MIN_PACKET_LENGTH || tvb_reported_length(tvb) != length)
+        return FALSE;
+
+    // Unlike Decode As, the heuristic only takes the upper case header X-Plane sends.
+    const xplane_message_t* message = xplane_find_message(tvb);
+    if (message == NULL || tvb_get_ntohl(tvb, 0) != message->fourcc)
+        return FALSE;
+
+    guint8 terminator = tvb_get_guint8(tvb, 4);
+    if (terminator != 0 && (message->heur_markers == NULL || strchr(message->heur_markers, terminator) == NULL))
+        return FALSE;
+
+    dissector_t dissector = xplane_select_dissector(message, length);
+    if (dissector == NULL)
+        return FALSE;
+    if (dissector == message->dissector)
+    {
+        if (message->heur_fixed_length != 0 && length != message->heur_fixed_length)
+            return FALSE;
+        if (message->heur_record_length != 0 && (length == xplane_HEADER_LENGTH || (length - xplane_HEADER_LENGTH) % message->heur_record_length != 0))
+            return FALSE;
+        if (length < message->heur_min_length)
+            return FALSE;
     }
-    else if (g_ascii_strncasecmp(bytes, "RREF", 4) == 0)
+    else if (length != message->in_exact_length && !xplane_heur_is_number(tvb, length))
     {
-        if (tvb_captured_length(tvb) == xplane_RREF_IN_PACKET_LENGTH)
-            return dissect_xplane_rref_in(tvb, pinfo, tree, data);
-        else
-            return dissect_xplane_rref_out(tvb, pinfo, tree, data);
-    }
-    else if (g_ascii_strncasecmp(bytes, "SHUT", 4) == 0)
-        return dissect_xplane_shut(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "SIMO", 4) == 0)
-        return dissect_xplane_simo(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "SOUN", 4) == 0)
-        return dissect_xplane_soun(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "SSND", 4) == 0)
-        return dissect_xplane_ssnd(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "UCOC", 4) == 0)
-        return dissect_xplane_ucoc(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "USEL", 4) == 0)
-        return dissect_xplane_usel(tvb, pinfo, tree, data);
-    else if (g_ascii_strncasecmp(bytes, "VEHX", 4) == 0)
-        return dissect_xplane_vehx(tvb, pinfo, tree, data);
-
-    return 0;
+        return FALSE;
+    }
+
+    // Pin the flow so the rest of it bypasses the heuristic.
+    conversation_t* conv = find_or_create_conversation(pinfo);
+    conversation_set_dissector(conv, xplane_udp_handle);
+
+    dissect_xplane(tvb, pinfo, tree, data);
+    return TRUE;
 }
 
 void proto_register_xplane(void)
@@ -2876,6 +4003,7 @@ void proto_register_xplane(void)
     {
         { &hf_xplane_data_header,   { "Header", "xplane.data",          FT_STRINGZ, BASE_NONE,  NULL,   0,  "DATA - As Configured with X-Plane",  HFILL}},
         { &hf_xplane_data_index,    { "Index",  "xplane.data.index",    FT_INT32,   BASE_DEC ,  NULL,   0,  "DATA Index",   HFILL}},
+        { &hf_xplane_data_present,  { "Indices Present", "xplane.data.present", FT_BYTES, BASE_NONE, NULL, 0, "Bitmap of the DATA indices in this packet. Index N is bit (1 << N%8) of byte N/8", HFILL}},
         { &hf_xplane_data_a,        { "A",      "xplane.data.a",        FT_FLOAT,   BASE_NONE,  NULL,   0,  "Item A",       HFILL}},
         { &hf_xplane_data_b,        { "B",      "xplane.data.b",        FT_FLOAT,   BASE_NONE,  NULL,   0,  "Item B",       HFILL}},
         { &hf_xplane_data_c,        { "C",      "xplane.data.c",        FT_FLOAT,   BASE_NONE,  NULL,   0,  "Item C",       HFILL}},
@@ -2918,7 +4046,18 @@ void proto_register_xplane(void)
         { &hf_xplane_flir_out_width,        { "Width",          "xplane.flir.width",        FT_INT16, BASE_DEC,     NULL,   0,  "Image Width",          HFILL}},
         { &hf_xplane_flir_out_frameindex,   { "Frame Index",    "xplane.flir.frameindex",   FT_UINT8, BASE_DEC,     NULL,   0,  "The index within this frame.",          HFILL}},
         { &hf_xplane_flir_out_framecount,   { "Frame Count",    "xplane.flir.framecount",   FT_UINT8, BASE_DEC,     NULL,   0,  "Number of packets to make up an image.",          HFILL}},
-        { &hf_xplane_flir_out_imagedata,    { "Image Date",     "xplane.flir.imagedata",    FT_BYTES, BASE_NONE,    NULL,   0,  "The image data. May need to be appended if split other multiple packets.", HFILL}}
+        { &hf_xplane_flir_out_imagedata,    { "Image Data",     "xplane.flir.imagedata",    FT_BYTES, BASE_NONE,    NULL,   0,  "This packet's part of the image.", HFILL}},
+        { &hf_xplane_flir_out_image,        { "Image",          "xplane.flir.image",        FT_BYTES, BASE_NONE,    NULL,   0,  "The whole image, reassembled from Frame Count packets.", HFILL}},
+        { &hf_xplane_flir_fragments,        { "Fragments",      "xplane.flir.fragments",    FT_NONE, BASE_NONE,     NULL,   0,  NULL, HFILL}},
+        { &hf_xplane_flir_fragment,         { "Fragment",       "xplane.flir.fragment",     FT_FRAMENUM, BASE_NONE, NULL,   0,  NULL, HFILL}},
+        { &hf_xplane_flir_fragment_overlap, { "Fragment Overlap", "xplane.flir.fragment.overlap", FT_BOOLEAN, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_fragment_overlap_conflicts, { "Fragment Overlapping With Conflicting Data", "xplane.flir.fragment.overlap.conflicts", FT_BOOLEAN, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_fragment_multiple_tails, { "Multiple Tail Fragments", "xplane.flir.fragment.multiple_tails", FT_BOOLEAN, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_fragment_too_long_fragment, { "Fragment Too Long", "xplane.flir.fragment.too_long_fragment", FT_BOOLEAN, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_fragment_error,   { "Defragmentation Error", "xplane.flir.fragment.error", FT_FRAMENUM, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_fragment_count,   { "Fragment Count", "xplane.flir.fragment.count", FT_UINT32, BASE_DEC, NULL,  0,  NULL, HFILL}},
+        { &hf_xplane_flir_reassembled_in,   { "Reassembled In", "xplane.flir.reassembled.in", FT_FRAMENUM, BASE_NONE, NULL, 0, NULL, HFILL}},
+        { &hf_xplane_flir_reassembled_length, { "Reassembled Length", "xplane.flir.reassembled.length", FT_UINT32, BASE_DEC, NULL, 0, NULL, HFILL}}
     };
     static hf_register_info hf_xplane_ise4[] =
     {
@@ -3035,21 +4174,58 @@ void proto_register_xplane(void)
         { &hf_xplane_rpos_out_vz,           { "Vz",         "xplane.rpos.vz",           FT_FLOAT,    BASE_NONE,  NULL,   0,  "Plane's Velocity (South)",                        HFILL}},
         { &hf_xplane_rpos_out_rollrate,     { "Rollrate",   "xplane.rpos.rollrate",     FT_FLOAT,    BASE_NONE,  NULL,   0,  "Plane's Roll Rate",                               HFILL}},
         { &hf_xplane_rpos_out_pitchrate,    { "Pitchrate",  "xplane.rpos.pitchrate",    FT_FLOAT,    BASE_NONE,  NULL,   0,  "Plane's Pitch Rate",                              HFILL}},
-        { &hf_xplane_rpos_out_yawrate,      { "Yawrate",    "xplane.rpos.yawrate",      FT_FLOAT,    BASE_NONE,  NULL,   0,  "Plane's Yaw Rate",                                HFILL}}
+        { &hf_xplane_rpos_out_yawrate,      { "Yawrate",    "xplane.rpos.yawrate",      FT_FLOAT,    BASE_NONE,  NULL,   0,  "Plane's Yaw Rate",                                HFILL}},
+        { &hf_xplane_rpos_out_prediction_error, { "Prediction Error", "xplane.rpos.prediction_error", FT_DOUBLE, BASE_NONE, NULL, 0, "Distance in metres between this position and the one dead reckoned from the previous RPOS", HFILL}}
+    };
+    static hf_register_info hf_xplane_action[] =
+    {
+        { &hf_xplane_action_effect_in,  { "Effect In",  "xplane.action.effect_in",  FT_FRAMENUM,      BASE_NONE, FRAMENUM_TYPE(FT_FRAMENUM_RESPONSE), 0, "Packet from the simulator that first reflects this action.", HFILL}},
+        { &hf_xplane_action_latency,    { "Control To Effect Latency", "xplane.action.latency", FT_RELATIVE_TIME, BASE_NONE, NULL, 0, "Time until the simulator's output reflected this action.", HFILL}},
+        { &hf_xplane_action_effect_of,  { "Effect Of",  "xplane.action.effect_of",  FT_FRAMENUM,      BASE_NONE, FRAMENUM_TYPE(FT_FRAMENUM_REQUEST), 0, "Action packet this packet is the first to reflect.", HFILL}}
+    };
+    static hf_register_info hf_xplane_slot[] =
+    {
+        { &hf_xplane_slot_path,         { "Slot Holds",         "xplane.slot.path",     FT_STRING,   BASE_NONE, NULL, 0, "Aircraft or object file loaded in the slot before this packet.", HFILL}},
+        { &hf_xplane_slot_livery,       { "Slot Livery",        "xplane.slot.livery",   FT_INT32,    BASE_DEC,  NULL, 0, "Livery loaded in the slot before this packet.", HFILL}},
+        { &hf_xplane_slot_loaded_in,    { "Slot Loaded In",     "xplane.slot.loaded_in", FT_FRAMENUM, BASE_NONE, NULL, 0, "ACFN, ACPR or OBJN that loaded the slot.", HFILL}},
+        { &hf_xplane_slot_previous,     { "Previous Slot Move", "xplane.slot.previous", FT_FRAMENUM, BASE_NONE, NULL, 0, "Previous ACPR, PREL, VEHX or OBJL for the slot.", HFILL}},
+        { &hf_xplane_slot_distance,     { "Slot Moved",         "xplane.slot.distance", FT_DOUBLE,   BASE_NONE, NULL, 0, "Metres from the slot's previous known position.", HFILL}}
+    };
+    static hf_register_info hf_xplane_cadence[] =
+    {
+        { &hf_xplane_cadence_interval,  { "Interval",           "xplane.cadence.interval", FT_DOUBLE, BASE_NONE, NULL, 0, "Seconds since the simulator's previous RPOS (out) or DATA to this client.", HFILL}},
+        { &hf_xplane_cadence_period,    { "Expected Interval",  "xplane.cadence.period",   FT_DOUBLE, BASE_NONE, NULL, 0, "Seconds between samples at the rate this client's RPOS (in) asked for, or the rate learned from the stream.", HFILL}},
+        { &hf_xplane_cadence_missing,   { "Missing",            "xplane.cadence.missing",  FT_UINT32, BASE_DEC,  NULL, 0, "Samples lost in the gap before this one.", HFILL}}
+    };
+    static hf_register_info hf_xplane_records[] =
+    {
+        { &hf_xplane_records_not_expanded, { "Records Not Expanded", "xplane.records.not_expanded", FT_UINT32, BASE_DEC, NULL, 0, "Records past the Maximum Expanded Records preference, summarised by the range of each field.", HFILL}}
+    };
+    static hf_register_info hf_xplane_dataref[] =
+    {
+        { &hf_xplane_dataref_type,      { "Type",       "xplane.dataref.type",      FT_STRING,  BASE_NONE,  NULL,   0,  "Type of the dataref in the DataRef file.",   HFILL}},
+        { &hf_xplane_dataref_units,     { "Units",      "xplane.dataref.units",     FT_STRING,  BASE_NONE,  NULL,   0,  "Units of the dataref in the DataRef file.",  HFILL}},
+        { &hf_xplane_dataref_writable,  { "Writable",   "xplane.dataref.writable",  FT_BOOLEAN, BASE_NONE,  NULL,   0,  "Whether the dataref can be written.",         HFILL}},
+        { &hf_xplane_dataref_int,       { "Integer Value", "xplane.dataref.int",    FT_INT32,   BASE_DEC,   NULL,   0,  "The value as the dataref's integer type.",    HFILL}},
+        { &hf_xplane_dataref_bool,      { "Boolean Value", "xplane.dataref.bool",   FT_BOOLEAN, BASE_NONE,  NULL,   0,  "The value of a boolean dataref.",             HFILL}}
     };
     static hf_register_info hf_xplane_rref_in[] =
     {
         { &hf_xplane_rref_in_header,    { "Header",     "xplane.rref",              FT_STRINGZ,     BASE_NONE,  NULL,   0,  "RREF Header (IN)", HFILL}},
         { &hf_xplane_rref_in_frequency, { "Frequency",  "xplane.rref.frequency",    FT_INT32,       BASE_DEC,   NULL,   0,  "Frequency. 0 to stop.",        HFILL}},
         { &hf_xplane_rref_in_id,        { "Id",         "xplane.rref.id",           FT_INT32,       BASE_DEC,   NULL,   0,  "Id to use for this dataref.",               HFILL}},
-        { &hf_xplane_rref_in_dataref,   { "Dataref",    "xplane.rref.dataref",      FT_STRINGZPAD,  BASE_NONE,  NULL,   0,  "The Dataref. Padded with '\0'.",          HFILL}}
+        { &hf_xplane_rref_in_dataref,   { "Dataref",    "xplane.rref.dataref",      FT_STRINGZPAD,  BASE_NONE,  NULL,   0,  "The Dataref. Padded with '\0'.",          HFILL}},
+        { &hf_xplane_rref_in_response,  { "Response In", "xplane.rref.response_in", FT_FRAMENUM,  BASE_NONE,  FRAMENUM_TYPE(FT_FRAMENUM_RESPONSE), 0, "Packet with the first value for this request.", HFILL}}
     };
     static hf_register_info hf_xplane_rref_out[] =
     {
         { &hf_xplane_rref_out_header,   { "Header", "xplane.rref",          FT_STRINGZ, BASE_NONE,  NULL,   0,  "RREF Header (OUT)",    HFILL}},
         { &hf_xplane_rref_out_id,       { "Id",     "xplane.rref.id",       FT_INT32,   BASE_DEC,   NULL,   0,  "Id for this dataref.",                   HFILL}},
         { &hf_xplane_rref_out_value,    { "Value",  "xplane.rref.value",    FT_FLOAT,   BASE_NONE,  NULL,   0,  "Value for this dataref.",                HFILL}},
-        { &hf_xplane_rref_out_idlink,   { "IdLink", "xplane.rref.idlink",   FT_STRINGZ, BASE_NONE,  NULL,   0,  "Packet that requested this ID.",         HFILL}}
+        { &hf_xplane_rref_out_dataref,  { "Dataref", "xplane.rref.dataref", FT_STRING, BASE_NONE,  NULL,   0,  "The Dataref this Id was requested for.",  HFILL}},
+        { &hf_xplane_rref_out_idlink,   { "IdLink", "xplane.rref.idlink",   FT_FRAMENUM, BASE_NONE, FRAMENUM_TYPE(FT_FRAMENUM_REQUEST), 0, "Packet that requested this ID.", HFILL}},
+        { &hf_xplane_rref_out_delta,    { "Delta",  "xplane.rref.delta",    FT_RELATIVE_TIME, BASE_NONE, NULL, 0, "Time since the previous value for this Id to this client.", HFILL}},
+        { &hf_xplane_rref_out_latency,  { "Latency", "xplane.rref.latency", FT_RELATIVE_TIME, BASE_NONE, NULL, 0, "Time from the request to its first value.", HFILL}}
     };
     static hf_register_info hf_xplane_shut[] =
     {
@@ -3112,6 +4288,8 @@ void proto_register_xplane(void)
         &ett_xplane_fail,
         &ett_xplane_flir_in,
         &ett_xplane_flir_out,
+        &ett_xplane_flir_fragment,
+        &ett_xplane_flir_fragments,
         &ett_xplane_ise4,
         &ett_xplane_ise6,
         &ett_xplane_lsnd,
@@ -3163,10 +4341,19 @@ void proto_register_xplane(void)
 
         { &ei_xplane_data_length,          { "xplane.ei.data.badlength",       PI_MALFORMED, PI_ERROR,       "Incorrect DATA length", EXPFILL }},
         { &ei_xplane_data_invalid_index,   { "xplane.ei.data.badindex",        PI_MALFORMED, PI_ERROR,       "Invalid Index", EXPFILL }},
+        { &ei_xplane_data_nonfinite,       { "xplane.ei.data.nonfinite",       PI_MALFORMED, PI_WARN,        "Value is NaN or infinite", EXPFILL }},
+        { &ei_xplane_data_sentinel,        { "xplane.ei.data.sentinel",        PI_UNDECODED, PI_NOTE,        "Value is -999 (not available)", EXPFILL }},
 
         { &ei_xplane_dcoc_id,              { "xplane.ei.dcoc.id",              PI_PROTOCOL,  PI_NOTE,        "Invalid ID", EXPFILL }},
         { &ei_xplane_dcoc_length,          { "xplane.ei.dcoc.badlength",       PI_MALFORMED, PI_ERROR,       "Incorrect DCOC length", EXPFILL }},
 
+        { &ei_xplane_flir_out_index,       { "xplane.ei.flir.frameindex",      PI_MALFORMED, PI_ERROR,       "Frame Index is not less than Frame Count", EXPFILL }},
+        { &ei_xplane_flir_out_size,        { "xplane.ei.flir.size",            PI_MALFORMED, PI_WARN,        "Frame size doesn't match Height x Width", EXPFILL }},
+        { &ei_xplane_action_no_effect,     { "xplane.ei.action.no_effect",     PI_SEQUENCE, PI_NOTE,         "No effect seen", EXPFILL }},
+
+        { &ei_xplane_dataref_element,      { "xplane.ei.dataref.element",      PI_PROTOCOL, PI_WARN,         "Array element out of range", EXPFILL }},
+        { &ei_xplane_dataref_readonly,     { "xplane.ei.dataref.readonly",     PI_PROTOCOL, PI_WARN,         "Write to a read only dataref", EXPFILL }},
+
         { &ei_xplane_dref_length,          { "xplane.ei.dref.badlength",       PI_MALFORMED, PI_ERROR,       "Incorrect DATA length", EXPFILL }},
 
         { &ei_xplane_dsel_id,              { "xplane.ei.dcoc.id",              PI_PROTOCOL,  PI_NOTE,        "Invalid ID", EXPFILL }},
@@ -3215,6 +4402,12 @@ void proto_register_xplane(void)
         { &ei_xplane_rpos_in_length,       { "xplane.ei.rpos_in.length",       PI_MALFORMED, PI_ERROR,       "Incorrect RPOS (IN) length", EXPFILL }},
 
         { &ei_xplane_rpos_out_length,      { "xplane.ei.rpos_out.length",      PI_MALFORMED, PI_ERROR,       "Incorrect RPOS (OUT) length", EXPFILL }},
+        { &ei_xplane_cadence_gap,          { "xplane.ei.cadence.gap",          PI_SEQUENCE, PI_WARN,         "Samples missing", EXPFILL }},
+        { &ei_xplane_cadence_late,         { "xplane.ei.cadence.late",         PI_SEQUENCE, PI_NOTE,         "Sample late", EXPFILL }},
+        { &ei_xplane_cadence_burst,        { "xplane.ei.cadence.burst",        PI_SEQUENCE, PI_NOTE,         "Samples bunched together", EXPFILL }},
+        { &ei_xplane_rpos_out_prediction,  { "xplane.ei.rpos_out.prediction",  PI_SEQUENCE, PI_WARN,         "Position doesn't follow from the previous RPOS", EXPFILL }},
+
+        { &ei_xplane_rref_out_unsubscribed, { "xplane.ei.rref_out.unsubscribed", PI_SEQUENCE, PI_WARN,       "Value after unsubscribe", EXPFILL }},
 
         { &ei_xplane_shut_length,          { "xplane.ei.shut.length",          PI_MALFORMED, PI_ERROR,       "Incorrect SHUT length", EXPFILL }},
 
@@ -3255,6 +4448,7 @@ void proto_register_xplane(void)
     proto_register_field_array(proto_xplane, hf_xplane_becn, array_length(hf_xplane_becn));
     proto_register_field_array(proto_xplane, hf_xplane_cmnd, array_length(hf_xplane_cmnd));
     proto_register_field_array(proto_xplane, hf_xplane_data, array_length(hf_xplane_data));
+    proto_register_field_array(proto_xplane, hf_xplane_data_fields, array_length(hf_xplane_data_fields));
     proto_register_field_array(proto_xplane, hf_xplane_dcoc, array_length(hf_xplane_dcoc));
     proto_register_field_array(proto_xplane, hf_xplane_dref, array_length(hf_xplane_dref));
     proto_register_field_array(proto_xplane, hf_xplane_dsel, array_length(hf_xplane_dsel));
@@ -3276,6 +4470,11 @@ void proto_register_xplane(void)
     proto_register_field_array(proto_xplane, hf_xplane_rese, array_length(hf_xplane_rese));
     proto_register_field_array(proto_xplane, hf_xplane_rpos_in, array_length(hf_xplane_rpos_in));
     proto_register_field_array(proto_xplane, hf_xplane_rpos_out, array_length(hf_xplane_rpos_out));
+    proto_register_field_array(proto_xplane, hf_xplane_action, array_length(hf_xplane_action));
+    proto_register_field_array(proto_xplane, hf_xplane_slot, array_length(hf_xplane_slot));
+    proto_register_field_array(proto_xplane, hf_xplane_cadence, array_length(hf_xplane_cadence));
+    proto_register_field_array(proto_xplane, hf_xplane_records, array_length(hf_xplane_records));
+    proto_register_field_array(proto_xplane, hf_xplane_dataref, array_length(hf_xplane_dataref));
     proto_register_field_array(proto_xplane, hf_xplane_rref_in, array_length(hf_xplane_rref_in));
     proto_register_field_array(proto_xplane, hf_xplane_rref_out, array_length(hf_xplane_rref_out));
     proto_register_field_array(proto_xplane, hf_xplane_shut, array_length(hf_xplane_shut));
@@ -3291,16 +4490,43 @@ void proto_register_xplane(void)
     prefs_register_uint_preference(xplane_udp_prefs_module, "sender_port", "X-Plane UDP Sender Port", "The outbound port that X-Plane sends from.", 10, &xplane_pref_udp_sender_port);
     prefs_register_uint_preference(xplane_udp_prefs_module, "external_app_port", "External App Port", "The port your external app uses.", 10, &xplane_pref_udp_external_app_port);
     prefs_register_uint_preference(xplane_udp_prefs_module, "beacon_port", "X-Plane UDP Beacon Port", "The port to listen on for BECN packets.", 10, &xplane_pref_becn_port);
+    prefs_register_enum_preference(xplane_udp_prefs_module, "data_labels", "DATA Labels", "Which X-Plane version's DATA labels to use. Automatic uses the version in the simulator's BECN packets.", &xplane_pref_data_table, xplane_data_table_enum_vals, FALSE);
+    prefs_register_uint_preference(xplane_udp_prefs_module, "action_timeout", "Control To Effect Timeout", "Seconds to wait for the simulator's output to reflect a DREF, VEHX, PREL or ACPR.", 10, &xplane_pref_action_timeout);
+    prefs_register_filename_preference(xplane_udp_prefs_module, "dataref_file", "DataRef File", "A DataRefs.txt from X-Plane's Resources/plugins folder. Its types and units are used to decode DREF and RREF values.", &xplane_pref_dataref_file, FALSE);
+    prefs_register_uint_preference(xplane_udp_prefs_module, "rpos_prediction_threshold", "RPOS Prediction Threshold", "Metres an RPOS position may be from the one dead reckoned from the previous RPOS before it is flagged.", 10, &xplane_pref_rpos_prediction_threshold);
+    prefs_register_uint_preference(xplane_udp_prefs_module, "max_records", "Maximum Expanded Records", "How many records of a DATA, RADR, RREF, DCOC, UCOC, DSEL or USEL packet get their own tree items. The rest are summarised in one item but can still be filtered on. 0 expands every record.", 10, &xplane_pref_max_records);
 
     expert_module_t* xplane_expert_module = expert_register_protocol(proto_xplane);
     expert_register_field_array(xplane_expert_module, ei, array_length(ei));
+
+    xplane_data_tap = register_tap(xplane_DATA_TAP_NAME);
+    xplane_rref_tap = register_tap(xplane_RREF_TAP_NAME);
+    xplane_action_tap = register_tap(xplane_ACTION_TAP_NAME);
+    xplane_flir_tap = register_tap(xplane_FLIR_TAP_NAME);
+    xplane_radr_tap = register_tap(xplane_RADR_TAP_NAME);
+    xplane_position_tap = register_tap(xplane_POSITION_TAP_NAME);
+    xplane_cadence_tap = register_tap(xplane_CADENCE_TAP_NAME);
+    register_init_routine(xplane_string_pool_init);
+    register_init_routine(xplane_action_init);
+    reassembly_table_register(&xplane_flir_reassembly_table, &addresses_ports_reassembly_table_functions);
+    xplane_flir_eo_tap = register_export_object(proto_xplane, xplane_flir_eo_packet, NULL);
+    xplane_flir_streams = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_host_hash, xplane_host_equal);
+    for (guint i = 0; i < xplane_STREAM_COUNT; i++)
+        xplane_cadence_streams[i] = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_cadence_key_hash, xplane_cadence_key_equal);
+    xplane_slot_tables = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_host_hash, xplane_host_equal);
+    xplane_rpos_streams = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_host_hash, xplane_host_equal);
+    xplane_sim_positions = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_host_hash, xplane_host_equal);
+    xplane_host_versions = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_host_hash, xplane_host_equal);
+    xplane_rref_subscriptions = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_rref_key_hash, xplane_rref_key_equal);
+    xplane_rref_unrequested = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), xplane_rref_key_hash, xplane_rref_key_equal);
+    xplane_dataref_cache = wmem_map_new_autoreset(wmem_epan_scope(), wmem_file_scope(), g_direct_hash, g_direct_equal);
+    xplane_register_stats();
 }
 
 void proto_reg_handoff_xplane(void)
 {
     static gboolean initialized = FALSE;
     static dissector_handle_t xplane_becn_handle;
-    static dissector_handle_t xplane_udp_handle;
 
     static guint32 current_udp_listener_port = 0;
     static guint32 current_udp_sender_port = 0;
@@ -3311,6 +4537,7 @@ void proto_reg_handoff_xplane(void)
     {
         xplane_udp_handle = create_dissector_handle(dissect_xplane, proto_xplane);
         xplane_becn_handle = create_dissector_handle(dissect_xplane, proto_xplane);
+        heur_dissector_add("udp", dissect_xplane_heur, "X-Plane over UDP", "xplane_udp", proto_xplane, HEURISTIC_ENABLE);
         initialized = TRUE;
     }
     else
@@ -3330,6 +4557,8 @@ void proto_reg_handoff_xplane(void)
     dissector_add_uint("udp.port", current_udp_sender_port, xplane_udp_handle);
     dissector_add_uint("udp.port", current_udp_external_app_port, xplane_udp_handle);
     dissector_add_uint("udp.port", current_becn_port, xplane_becn_handle);
+
+    xplane_dataref_dictionary_load();
 }
 
 /*
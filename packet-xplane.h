@@ -0,0 +1,186 @@
+/* packet-xplane.h
+ * Definitions shared between the X-Plane dissector and its statistics
+ * Copyright 2020, Avacee
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * SPDX-License-Identifier: GNU v3
+ */
+
+#ifndef __PACKET_XPLANE_H__
+#define __PACKET_XPLANE_H__
+
+#include <glib.h>
+#include <epan/address.h>
+#include <wsutil/nstime.h>
+
+#define xplane_MAX_DATA_INDEX 139
+#define xplane_DATA_VALUE_COUNT 8
+
+// Name of the tap fed by dissect_xplane_data with an xplane_data_tap_info_t per packet.
+#define xplane_DATA_TAP_NAME "xplane.data"
+
+typedef struct xplane_data_record
+{
+    gint32 index;
+    gfloat values[xplane_DATA_VALUE_COUNT];
+    guint8 nonfinite;   // bit n set when values[n] is NaN or +/-Inf
+    guint8 sentinel;    // bit n set when values[n] is -999
+} xplane_data_record_t;
+
+typedef struct xplane_data_tap_info
+{
+    guint table;        // DATA label table the packet was dissected with
+    guint count;
+    const xplane_data_record_t* records;
+} xplane_data_tap_info_t;
+
+// Name of the tap fed by both RREF directions with an xplane_rref_tap_info_t per packet.
+#define xplane_RREF_TAP_NAME "xplane.rref"
+
+typedef struct xplane_rref_value
+{
+    gint32 id;
+    gfloat value;
+    const char* dataref;        // NULL when the request wasn't captured
+    guint32 dataref_id;         // the dataref's id in the capture's string pool, 0 when not captured
+    gint32 frequency;           // requested rate in force, 0 after unsubscribe, -1 unknown
+    guint32 request_frame;      // frame of that request, 0 unknown
+    gdouble delta;              // seconds since this client's previous value for the id, < 0 for the first
+    const nstime_t* latency;    // time since the request when this is its first value, else NULL
+} xplane_rref_value_t;
+
+typedef struct xplane_rref_tap_info
+{
+    gboolean request;           // TRUE for a client's RREF request, FALSE for values from the simulator
+    const address* client;
+    guint32 port;
+
+    // request
+    gint32 id;
+    gint32 frequency;
+    const char* dataref;
+    guint32 dataref_id;         // 0 for a blank dataref
+
+    // values
+    guint count;
+    const xplane_rref_value_t* values;
+} xplane_rref_tap_info_t;
+
+// Name of the tap fed with an xplane_action_tap_info_t when a DREF, VEHX, PREL or ACPR is sent and again when its effect is seen.
+#define xplane_ACTION_TAP_NAME "xplane.action"
+
+typedef enum
+{
+    xplane_ACTION_DREF,
+    xplane_ACTION_VEHX,
+    xplane_ACTION_PREL,
+    xplane_ACTION_ACPR,
+    xplane_ACTION_MESSAGE_COUNT
+} xplane_action_message_t;
+
+typedef struct xplane_action_tap_info
+{
+    xplane_action_message_t message;
+    const nstime_t* latency;    // NULL when the action is sent, the control to effect latency once it is seen
+} xplane_action_tap_info_t;
+
+const char* xplane_action_message_name(xplane_action_message_t message);
+
+// Name of the tap fed with an xplane_flir_tap_info_t by every FLIR frame rate request and image fragment.
+#define xplane_FLIR_TAP_NAME "xplane.flir"
+
+typedef struct xplane_flir_tap_info
+{
+    gboolean request;           // TRUE for a FLIR-in frame rate request, FALSE for a FLIR-out fragment
+    const address* sim;         // the simulator sending the images
+
+    // request
+    gdouble framerate;          // frames per second asked for, 0 if not a number
+
+    // fragment
+    guint32 frame;              // reassembly id of the fragment's frame, counted from 1 per simulator
+    guint32 frameindex;
+    guint32 framecount;
+    guint length;               // image bytes in the fragment
+} xplane_flir_tap_info_t;
+
+// Name of the tap fed by dissect_xplane_radr_out with an xplane_radr_tap_info_t per packet.
+#define xplane_RADR_TAP_NAME "xplane.radr"
+
+typedef struct xplane_radr_point
+{
+    gfloat longitude;
+    gfloat latitude;
+    gint8 precipitation;        // 0 to 100
+    gfloat height;              // storm top, metres above sea level
+} xplane_radr_point_t;
+
+typedef struct xplane_radr_tap_info
+{
+    guint count;
+    const xplane_radr_point_t* points;
+} xplane_radr_tap_info_t;
+
+// Aircraft slots: 0 is the user's aircraft, 1 to 19 are AI aircraft.
+#define xplane_AIRCRAFT_SLOTS 20
+
+// Name of the tap fed with an xplane_position_tap_info_t by RPOS, VEHX, ACPR, PREL and DATA positions.
+#define xplane_POSITION_TAP_NAME "xplane.position"
+
+typedef struct xplane_position_tap_info
+{
+    const address* sim;
+    gint32 aircraft;            // slot, 0 to xplane_AIRCRAFT_SLOTS - 1
+    gboolean reposition;        // ACPR or PREL moved the aircraft, so its track breaks here
+    gboolean known_position;    // FALSE for a reposition to a runway or ramp, which only breaks the track
+    gdouble latitude;
+    gdouble longitude;
+    gdouble elevation;          // metres above mean sea level
+    gdouble heading;            // true heading, pitch and roll in degrees, NaN when not sent
+    gdouble pitch;
+    gdouble roll;
+} xplane_position_tap_info_t;
+
+// Name of the tap fed with an xplane_cadence_tap_info_t by every RPOS (out) and DATA packet.
+#define xplane_CADENCE_TAP_NAME "xplane.cadence"
+
+typedef enum
+{
+    xplane_STREAM_RPOS,
+    xplane_STREAM_DATA,
+    xplane_STREAM_COUNT
+} xplane_stream_t;
+
+typedef enum
+{
+    xplane_INTERVAL_UNKNOWN,    // the stream's first sample, or its period isn't known yet
+    xplane_INTERVAL_ON_TIME,
+    xplane_INTERVAL_LATE,       // over a quarter of a period late
+    xplane_INTERVAL_GAP,        // late enough that samples are missing
+    xplane_INTERVAL_BURST       // under half a period after the previous sample
+} xplane_interval_t;
+
+typedef struct xplane_cadence_tap_info
+{
+    const address* sim;
+    const address* client;      // where the simulator sends the stream
+    guint32 port;               // the client's
+    xplane_stream_t stream;
+    xplane_interval_t kind;
+    gdouble interval;           // seconds since the stream's previous sample, < 0 for the first
+    gdouble period;             // expected seconds between samples, 0 while unknown
+    gboolean requested;         // the period is the rate RPOS-in asked for rather than learned
+    guint32 missing;            // samples lost in a gap
+} xplane_cadence_tap_info_t;
+
+const char* xplane_stream_name(xplane_stream_t stream);
+
+/* Label of a DATA index (column 0) or of one of its values (columns 1-8) in a label table. Never NULL. */
+const char* xplane_data_label(guint table, guint index, guint column);
+
+void xplane_register_stats(void);
+
+#endif /* __PACKET_XPLANE_H__ */
@@ -0,0 +1,280 @@
+/* xplane-bench.c
+ * Microbenchmarks for the X-Plane dissector's per-packet decoding
+ * Copyright 2020, Avacee
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * SPDX-License-Identifier: GNU v3
+ */
+
+ /*
+   Not part of the plugin. The xplane-bench target is left out of the default
+   build and links against epan directly:
+
+       cmake --build . --target xplane-bench
+       xplane-bench [packets]
+
+   packet-xplane.c is included rather than linked so its static decoders can be
+   timed without registering the protocol. The DATA decoder is chosen at compile
+   time, so configure with -mavx2 (or -march=native) in CMAKE_C_FLAGS to time the
+   AVX2 path rather than SSE2.
+
+   data   xplane_data_decode_records against fetching each value with
+          tvb_get_letohieee_float and classifying it, for a packet of
+          xplane_BENCH_DATA_RECORDS records. Both must produce the same
+          records. Only the decoding is timed: the old path also added one
+          proto_tree_add_item per float, and that tree building is left out
+          on purpose, as it needs a registered protocol and an edt and it
+          still happens for the records a tree shows.
+
+   rref   xplane_rref_out_map_values, the per value work of an RREF-out packet
+          of xplane_BENCH_RREF_VALUES values: the first pass, which also works
+          out each value's interval, and re-dissection. It is run with more
+          subscriptions, a longer rebinding history per id and values whose
+          request was never captured, to show the cost per value stays flat.
+  */
+#include "packet-xplane.c"
+
+#include <epan/wmem_scopes.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(xplane_DATA_DECODE_AVX2)
+#define xplane_BENCH_DATA_PATH "AVX2"
+#elif defined(xplane_DATA_DECODE_SSE2)
+#define xplane_BENCH_DATA_PATH "SSE2"
+#else
+#define xplane_BENCH_DATA_PATH "scalar"
+#endif
+
+#define xplane_BENCH_PACKETS 200000
+#define xplane_BENCH_DATA_RECORDS 16
+#define xplane_BENCH_RREF_VALUES 128
+
+static volatile guint32 xplane_bench_sink;
+
+static gdouble xplane_bench_ns_per_packet(gint64 start, guint packets)
+{
+    return (gdouble)(g_get_monotonic_time() - start) * 1000.0 / packets;
+}
+
+static void xplane_bench_fold(const xplane_data_record_t* records, guint count)
+{
+    guint32 sum = 0;
+    for (guint r = 0; r < count; r++)
+        sum += (guint32)records[r].index + records[r].nonfinite + records[r].sentinel;
+    xplane_bench_sink += sum;
+}
+
+// ---------- DATA ----------
+// A typical outgoing DATA packet: mostly finite values, some -999 "no value" markers and one NaN.
+static tvbuff_t* xplane_bench_data_packet(void)
+{
+    guint length = xplane_BENCH_DATA_RECORDS * xplane_DATA_STRUCT_LENGTH;
+    guint8* bytes = (guint8*)g_malloc(length);
+
+    for (guint r = 0; r < xplane_BENCH_DATA_RECORDS; r++)
+    {
+        guint8* raw = bytes + (r * xplane_DATA_STRUCT_LENGTH);
+        phtole32(raw, r * 3);
+        for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+        {
+            union { guint32 bits; gfloat value; } word;
+            if ((r + n) % 5 == 0)
+                word.value = -999.0f;
+            else if (r == 7 && n == 3)
+                word.value = NAN;
+            else
+                word.value = (gfloat)(r * 100 + n) / 7.0f;
+            phtole32(raw + 4 + (4 * n), word.bits);
+        }
+    }
+
+    tvbuff_t* tvb = tvb_new_real_data(bytes, length, length);
+    tvb_set_free_cb(tvb, g_free);
+    return tvb;
+}
+
+static void xplane_bench_data_per_field(tvbuff_t* tvb, guint count, xplane_data_record_t* records)
+{
+    for (guint r = 0; r < count; r++)
+    {
+        xplane_data_record_t* record = &records[r];
+        gint offset = r * xplane_DATA_STRUCT_LENGTH;
+
+        record->index = tvb_get_letohil(tvb, offset);
+        record->nonfinite = 0;
+        record->sentinel = 0;
+        for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+        {
+            gfloat value = tvb_get_letohieee_float(tvb, offset + 4 + (4 * n));
+            record->values[n] = value;
+            if (!isfinite(value))
+                record->nonfinite |= (guint8)(1u << n);
+            if (value == -999.0f)
+                record->sentinel |= (guint8)(1u << n);
+        }
+    }
+}
+
+static gboolean xplane_bench_data(guint packets)
+{
+    tvbuff_t* tvb = xplane_bench_data_packet();
+    xplane_data_record_t expected[xplane_BENCH_DATA_RECORDS];
+    xplane_data_record_t records[xplane_BENCH_DATA_RECORDS];
+
+    memset(expected, 0, sizeof(expected));
+    memset(records, 0, sizeof(records));
+    xplane_bench_data_per_field(tvb, xplane_BENCH_DATA_RECORDS, expected);
+    xplane_data_decode_records(tvb, xplane_BENCH_DATA_RECORDS, records);
+    if (memcmp(expected, records, sizeof(records)) != 0)
+    {
+        fprintf(stderr, "xplane-bench: xplane_data_decode_records (%s) disagrees with tvb_get_letohieee_float\n", xplane_BENCH_DATA_PATH);
+        tvb_free(tvb);
+        return FALSE;
+    }
+
+    gint64 start = g_get_monotonic_time();
+    for (guint p = 0; p < packets; p++)
+    {
+        xplane_bench_data_per_field(tvb, xplane_BENCH_DATA_RECORDS, records);
+        xplane_bench_fold(records, xplane_BENCH_DATA_RECORDS);
+    }
+    gdouble per_field = xplane_bench_ns_per_packet(start, packets);
+
+    start = g_get_monotonic_time();
+    for (guint p = 0; p < packets; p++)
+    {
+        xplane_data_decode_records(tvb, xplane_BENCH_DATA_RECORDS, records);
+        xplane_bench_fold(records, xplane_BENCH_DATA_RECORDS);
+    }
+    gdouble decoded = xplane_bench_ns_per_packet(start, packets);
+
+    printf("DATA, %u records per packet, %u packets\n", xplane_BENCH_DATA_RECORDS, packets);
+    printf("  %-34s %8.1f ns/packet\n", "tvb_get_letohieee_float per value", per_field);
+    printf("  %-34s %8.1f ns/packet  %.2fx\n", "xplane_data_decode_records (" xplane_BENCH_DATA_PATH ")", decoded, per_field / decoded);
+
+    tvb_free(tvb);
+    return TRUE;
+}
+
+// ---------- RREF ----------
+typedef struct xplane_bench_rref_case
+{
+    const char* name;
+    guint clients;      // each subscribes ids 0 to xplane_BENCH_RREF_VALUES - 1
+    guint bindings;     // requests per id, each with a different dataref
+    gboolean requested; // FALSE when the measured client's requests weren't captured
+} xplane_bench_rref_case_t;
+
+static const xplane_bench_rref_case_t xplane_bench_rref_cases[] =
+{
+    { "1 client",                      1,  1, TRUE  },
+    { "64 clients",                   64,  1, TRUE  },
+    { "1 client, 16 requests per id",  1, 16, TRUE  },
+    { "request not captured",          1,  1, FALSE }
+};
+
+static void xplane_bench_rref_subscribe(const xplane_bench_rref_case_t* bench, guint32* addresses)
+{
+    nstime_t time = NSTIME_INIT_ZERO;
+    guint32 frame = 1;
+
+    for (guint b = 0; b < bench->bindings; b++)
+    {
+        for (guint c = 0; c < bench->clients; c++)
+        {
+            // Client 0 is the one measured.
+            if (c == 0 && !bench->requested)
+                continue;
+
+            address client;
+            set_address(&client, AT_IPv4, 4, &addresses[c]);
+            for (gint32 id = 0; id < xplane_BENCH_RREF_VALUES; id++)
+            {
+                char dataref[64];
+                snprintf(dataref, sizeof(dataref), "sim/bench/client%u/value%d[%u]", c, id, b);
+                xplane_rref_bind(xplane_rref_lookup_or_add(&client, 49100, id), frame, &time, xplane_string_intern(dataref), 20);
+            }
+            frame++;
+        }
+    }
+}
+
+static void xplane_bench_rref(guint packets)
+{
+    printf("RREF-out, %u values per packet, %u packets\n", xplane_BENCH_RREF_VALUES, packets);
+    printf("  %-34s %23s %23s\n", "", "first pass", "revisit");
+    printf("  %-34s %13s %9s %13s %9s\n", "", "ns/packet", "ns/value", "ns/packet", "ns/value");
+
+    for (guint k = 0; k < array_length(xplane_bench_rref_cases); k++)
+    {
+        const xplane_bench_rref_case_t* bench = &xplane_bench_rref_cases[k];
+        guint32* addresses = g_new(guint32, bench->clients);
+        for (guint c = 0; c < bench->clients; c++)
+            addresses[c] = g_htonl(0xC0A80100u + 10 + c);
+
+        wmem_enter_file_scope();
+        xplane_string_pool_init();
+        xplane_rref_subscriptions = wmem_map_new(wmem_file_scope(), xplane_rref_key_hash, xplane_rref_key_equal);
+        xplane_rref_unrequested = wmem_map_new(wmem_file_scope(), xplane_rref_key_hash, xplane_rref_key_equal);
+        xplane_bench_rref_subscribe(bench, addresses);
+
+        xplane_rref_value_t values[xplane_BENCH_RREF_VALUES];
+        nstime_t deltas[xplane_BENCH_RREF_VALUES];
+        for (gint32 id = 0; id < xplane_BENCH_RREF_VALUES; id++)
+        {
+            values[id].id = id;
+            values[id].value = (gfloat)id;
+        }
+
+        // The simulator sends each packet back to the measured client, 20 times a second.
+        packet_info pinfo;
+        memset(&pinfo, 0, sizeof(pinfo));
+        set_address(&pinfo.dst, AT_IPv4, 4, &addresses[0]);
+        pinfo.destport = 49100;
+        guint32 first_frame = bench->clients * bench->bindings + 1;
+
+        gdouble passes[2];
+        for (guint pass = 0; pass < 2; pass++)
+        {
+            gint64 start = g_get_monotonic_time();
+            for (guint p = 0; p < packets; p++)
+            {
+                pinfo.num = first_frame + p;
+                pinfo.abs_ts.secs = p / 20;
+                pinfo.abs_ts.nsecs = (p % 20) * 50000000;
+                xplane_rref_out_map_values(&pinfo, values, xplane_BENCH_RREF_VALUES, deltas, pass == 0, FALSE);
+                xplane_bench_sink += (guint32)values[p % xplane_BENCH_RREF_VALUES].dataref_id;
+            }
+            passes[pass] = xplane_bench_ns_per_packet(start, packets);
+        }
+        printf("  %-34s %13.1f %9.2f %13.1f %9.2f\n", bench->name,
+            passes[0], passes[0] / xplane_BENCH_RREF_VALUES, passes[1], passes[1] / xplane_BENCH_RREF_VALUES);
+
+        wmem_leave_file_scope();
+        g_free(addresses);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    guint packets = argc > 1 ? (guint)strtoul(argv[1], NULL, 10) : xplane_BENCH_PACKETS;
+    if (packets == 0)
+        packets = xplane_BENCH_PACKETS;
+
+    wmem_init();
+    wmem_init_scopes();
+
+    gboolean ok = xplane_bench_data(packets);
+    if (ok)
+        xplane_bench_rref(packets);
+
+    wmem_cleanup_scopes();
+    wmem_cleanup();
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,2055 @@
+/* xplane-stats.c
+ * tshark -z statistics for the X-Plane dissector
+ * Copyright 2020, Avacee
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * SPDX-License-Identifier: GNU v3
+ */
+
+ /*
+   The statistics print straight to stdout like tshark's own ui/cli taps, so they
+   live outside packet-xplane.c and are not subject to the dissector API checks.
+
+   -z xplane,data[,filter]
+      count, min, max, mean, standard deviation and first/last time of every
+      DATA index/value seen. Each sample is folded into its accumulator as it
+      arrives (Welford's method) so nothing is kept per packet.
+
+   -z xplane,rref[,filter]
+      every RREF subscription (client, port and id) with its dataref, the
+      requested and achieved rate since the rate last changed, the values that
+      should have arrived but didn't and those that arrived after unsubscribing.
+
+   -z xplane,jitter[,filter]
+      p50/p90/p99/max of the interval between each RREF stream's values and of
+      its distance from the requested period, from fixed size histograms.
+
+   -z xplane,latency[,filter]
+      distribution of the time from each RREF request to its first value, and
+      how many subscriptions are still waiting for one.
+
+   -z xplane,actions[,filter]
+      per DREF, VEHX, PREL and ACPR: how many were sent, how many had a visible
+      effect and the distribution of the time until it was seen.
+
+   -z xplane,flir[,filter]
+      per simulator: the FLIR frame rate asked for against the rate complete
+      frames arrived at, incomplete frames, fragments that never arrived, bytes
+      per frame and bandwidth. Only the frame being received is tracked.
+
+   -z xplane,radr[,ascii|csv[,cell degrees]][,filter]
+      the weather the simulator reported in RADR, folded into a lat/lon grid
+      (0.1 degree cells by default) holding each cell's point count, maximum
+      precipitation and maximum storm height. Cells are only created where
+      points land, so memory is bounded by the grid, not the capture. Printed
+      as a precipitation map (ascii, the default) or one line per cell (csv).
+
+   -z xplane,track,csv|kml|gpx,file[,filter]
+      writes every aircraft's track, per simulator and slot, to file as the
+      capture is read. Positions come from RPOS, VEHX, DATA and the ACPR/PREL
+      repositions, which start a new segment. Each aircraft only buffers its
+      latest samples, as parallel time/lat/lon/elevation/attitude arrays.
+      CSV rows go straight to the file. KML and GPX points are spooled to a
+      temporary file per aircraft and copied out as one Placemark or trk when
+      the segment ends, as the aircraft's elements would otherwise interleave.
+
+   -z xplane,conformance[,filter]
+      per RPOS and DATA stream from a simulator to a client address and port:
+      the period expected (asked for by that client's RPOS-in or learned), how
+      many samples were on time, late or in a burst, the gaps and the samples
+      they lost, the longest interval and the share of expected samples that
+      arrived on time.
+  */
+#include <config.h>
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include <epan/packet.h>
+#include <epan/tap.h>
+#include <epan/stat_tap_ui.h>
+
+#include <wsutil/bits_ctz.h>
+#include <wsutil/file_util.h>
+#include <wsutil/tempfile.h>
+
+#include "packet-xplane.h"
+
+// ---------- -z xplane,data ----------
+typedef struct xplane_data_cell_stats
+{
+    guint64 count;
+    gdouble min;
+    gdouble max;
+    gdouble mean;
+    gdouble m2;
+    gdouble first_time;
+    gdouble last_time;
+} xplane_data_cell_stats_t;
+
+typedef struct xplane_data_stats
+{
+    char* filter;
+    guint table;        // label table of the last DATA packet
+    guint64 packets;
+    guint64 invalid_indices;
+    guint64 nonfinite;
+    guint64 sentinel;
+    xplane_data_cell_stats_t cells[xplane_MAX_DATA_INDEX][xplane_DATA_VALUE_COUNT];
+} xplane_data_stats_t;
+
+static void xplane_data_stats_reset(void* tapdata)
+{
+    xplane_data_stats_t* stats = (xplane_data_stats_t*)tapdata;
+
+    stats->table = 0;
+    stats->packets = 0;
+    stats->invalid_indices = 0;
+    stats->nonfinite = 0;
+    stats->sentinel = 0;
+    memset(stats->cells, 0, sizeof stats->cells);
+}
+
+static tap_packet_status xplane_data_stats_packet(void* tapdata, packet_info* pinfo, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_data_stats_t* stats = (xplane_data_stats_t*)tapdata;
+    const xplane_data_tap_info_t* tap_info = (const xplane_data_tap_info_t*)data;
+    gdouble now = nstime_to_sec(&pinfo->rel_ts);
+
+    stats->packets++;
+    stats->table = tap_info->table;
+    for (guint r = 0; r < tap_info->count; r++)
+    {
+        const xplane_data_record_t* record = &tap_info->records[r];
+        if (record->index < 0 || record->index >= xplane_MAX_DATA_INDEX)
+        {
+            stats->invalid_indices++;
+            continue;
+        }
+
+        for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+        {
+            // NaN/Inf and the -999 marker are counted but kept out of the ranges.
+            if ((record->nonfinite >> n) & 1)
+            {
+                stats->nonfinite++;
+                continue;
+            }
+            if ((record->sentinel >> n) & 1)
+            {
+                stats->sentinel++;
+                continue;
+            }
+
+            xplane_data_cell_stats_t* cell = &stats->cells[record->index][n];
+            gdouble value = record->values[n];
+            if (cell->count == 0)
+            {
+                cell->min = value;
+                cell->max = value;
+                cell->first_time = now;
+            }
+            else
+            {
+                if (value < cell->min)
+                    cell->min = value;
+                if (value > cell->max)
+                    cell->max = value;
+            }
+            cell->count++;
+            gdouble delta = value - cell->mean;
+            cell->mean += delta / (gdouble)cell->count;
+            cell->m2 += delta * (value - cell->mean);
+            cell->last_time = now;
+        }
+    }
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_data_stats_draw(void* tapdata)
+{
+    const xplane_data_stats_t* stats = (const xplane_data_stats_t*)tapdata;
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane DATA Statistics:\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("DATA packets: %" G_GUINT64_FORMAT "  Invalid indices: %" G_GUINT64_FORMAT "  NaN/Inf values: %" G_GUINT64_FORMAT "  -999 values: %" G_GUINT64_FORMAT "\n",
+        stats->packets, stats->invalid_indices, stats->nonfinite, stats->sentinel);
+    printf("%5s %3s %-40s %10s %14s %14s %14s %14s %12s %12s\n", "Index", "Val", "Label", "Count", "Min", "Max", "Mean", "StdDev", "First (s)", "Last (s)");
+
+    for (guint index = 0; index < xplane_MAX_DATA_INDEX; index++)
+    {
+        gboolean title_printed = FALSE;
+        for (guint n = 0; n < xplane_DATA_VALUE_COUNT; n++)
+        {
+            const xplane_data_cell_stats_t* cell = &stats->cells[index][n];
+            if (cell->count == 0)
+                continue;
+
+            if (!title_printed)
+            {
+                printf("%5u     %s\n", index, xplane_data_label(stats->table, index, 0));
+                title_printed = TRUE;
+            }
+            gdouble stddev = cell->count > 1 ? sqrt(cell->m2 / (gdouble)(cell->count - 1)) : 0.0;
+            printf("%5u %3c %-40.40s %10" G_GUINT64_FORMAT " %14.6g %14.6g %14.6g %14.6g %12.6f %12.6f\n",
+                index, 'A' + n, xplane_data_label(stats->table, index, n + 1), cell->count, cell->min, cell->max, cell->mean, stddev, cell->first_time, cell->last_time);
+        }
+    }
+    printf("=====================================================================================================================================\n");
+}
+
+static void xplane_data_stats_finish(void* tapdata)
+{
+    xplane_data_stats_t* stats = (xplane_data_stats_t*)tapdata;
+
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_data_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,data,";
+    xplane_data_stats_t* stats = g_new0(xplane_data_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+
+    GString* error = register_tap_listener(xplane_DATA_TAP_NAME, stats, stats->filter, 0, xplane_data_stats_reset, xplane_data_stats_packet, xplane_data_stats_draw, xplane_data_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,data tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_data_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_data_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,data",
+    xplane_data_stats_init,
+    0,
+    NULL
+};
+
+// ---------- RREF streams ----------
+/*
+   Both RREF statistics keep one entry per stream, i.e. per client address,
+   port and id, in a GHashTable. Every entry starts with an xplane_rref_stream_t
+   which is both the hash key and the part the two have in common.
+*/
+typedef struct xplane_rref_stream
+{
+    address client;
+    guint32 port;
+    gint32 id;
+    char* dataref;
+    guint32 dataref_id;         // the dissector's string pool id for dataref
+    gint32 frequency;           // requested rate in force, 0 after unsubscribe, -1 unknown
+} xplane_rref_stream_t;
+
+static guint xplane_rref_stream_hash(gconstpointer key)
+{
+    const xplane_rref_stream_t* stream = (const xplane_rref_stream_t*)key;
+    return add_address_to_hash(stream->port ^ ((guint)stream->id << 16), &stream->client);
+}
+
+static gboolean xplane_rref_stream_equal(gconstpointer a, gconstpointer b)
+{
+    const xplane_rref_stream_t* stream_a = (const xplane_rref_stream_t*)a;
+    const xplane_rref_stream_t* stream_b = (const xplane_rref_stream_t*)b;
+    return stream_a->port == stream_b->port && stream_a->id == stream_b->id && addresses_equal(&stream_a->client, &stream_b->client);
+}
+
+static void xplane_rref_stream_free(gpointer data)
+{
+    xplane_rref_stream_t* stream = (xplane_rref_stream_t*)data;
+
+    free_address(&stream->client);
+    g_free(stream->dataref);
+    g_free(stream);
+}
+
+// Keys and values are the same entry, so it's only freed once.
+static GHashTable* xplane_rref_streams_new(void)
+{
+    return g_hash_table_new_full(xplane_rref_stream_hash, xplane_rref_stream_equal, NULL, xplane_rref_stream_free);
+}
+
+static gpointer xplane_rref_streams_find(GHashTable* streams, const address* client, guint32 port, gint32 id)
+{
+    xplane_rref_stream_t key;
+    key.client = *client;
+    key.port = port;
+    key.id = id;
+    return g_hash_table_lookup(streams, &key);
+}
+
+// Finds or adds the entry, of entry_size bytes, for a stream.
+static gpointer xplane_rref_streams_get(GHashTable* streams, gsize entry_size, const address* client, guint32 port, gint32 id)
+{
+    xplane_rref_stream_t* stream = (xplane_rref_stream_t*)xplane_rref_streams_find(streams, client, port, id);
+    if (stream == NULL)
+    {
+        stream = (xplane_rref_stream_t*)g_malloc0(entry_size);
+        copy_address(&stream->client, client);
+        stream->port = port;
+        stream->id = id;
+        stream->frequency = -1;
+        g_hash_table_insert(streams, stream, stream);
+    }
+    return stream;
+}
+
+// The ids spare a string comparison for every value; the copy outlives the capture's pool for draw().
+static void xplane_rref_stream_set_dataref(xplane_rref_stream_t* stream, const char* dataref, guint32 dataref_id)
+{
+    if (dataref_id == 0 || dataref_id == stream->dataref_id)
+        return;
+    g_free(stream->dataref);
+    stream->dataref = g_strdup(dataref);
+    stream->dataref_id = dataref_id;
+}
+
+static gint xplane_rref_stream_compare(gconstpointer a, gconstpointer b)
+{
+    const xplane_rref_stream_t* stream_a = *(const xplane_rref_stream_t* const*)a;
+    const xplane_rref_stream_t* stream_b = *(const xplane_rref_stream_t* const*)b;
+
+    gint result = g_strcmp0(stream_a->dataref, stream_b->dataref);
+    if (result == 0)
+        result = cmp_address(&stream_a->client, &stream_b->client);
+    if (result == 0)
+        result = stream_a->port < stream_b->port ? -1 : stream_a->port > stream_b->port;
+    if (result == 0)
+        result = stream_a->id < stream_b->id ? -1 : stream_a->id > stream_b->id;
+    return result;
+}
+
+// The entries ordered by dataref then client. Free with g_ptr_array_free(, TRUE).
+static GPtrArray* xplane_rref_streams_sorted(GHashTable* streams)
+{
+    GPtrArray* sorted = g_ptr_array_sized_new(g_hash_table_size(streams));
+    GHashTableIter iter;
+    gpointer stream;
+
+    g_hash_table_iter_init(&iter, streams);
+    while (g_hash_table_iter_next(&iter, &stream, NULL))
+        g_ptr_array_add(sorted, stream);
+    g_ptr_array_sort(sorted, xplane_rref_stream_compare);
+    return sorted;
+}
+
+static void xplane_rref_stream_print_start(const xplane_rref_stream_t* stream)
+{
+    char* client = address_to_str(NULL, &stream->client);
+    char* endpoint = g_strdup_printf("%s:%u", client, stream->port);
+    char requested[16] = "?";
+
+    if (stream->frequency == 0)
+        g_strlcpy(requested, "unsub", sizeof requested);
+    else if (stream->frequency > 0)
+        snprintf(requested, sizeof requested, "%d", stream->frequency);
+
+    printf("%-50.50s %-28.28s %6d %8s", stream->dataref ? stream->dataref : "<request not captured>", endpoint, stream->id, requested);
+
+    g_free(endpoint);
+    wmem_free(NULL, client);
+}
+
+// ---------- -z xplane,rref ----------
+typedef struct xplane_rref_rate
+{
+    xplane_rref_stream_t stream;
+    guint requests;
+    guint64 values;
+    guint64 missing;
+    guint64 after_unsubscribe;
+
+    // Values since the requested rate last changed, for the achieved rate.
+    guint64 period_values;
+    gdouble period_first;
+    gdouble period_last;
+} xplane_rref_rate_t;
+
+typedef struct xplane_rref_stats
+{
+    char* filter;
+    GHashTable* streams;        // xplane_rref_rate_t
+} xplane_rref_stats_t;
+
+static void xplane_rref_rate_set_frequency(xplane_rref_rate_t* rate, gint32 frequency)
+{
+    if (rate->stream.frequency == frequency)
+        return;
+    rate->stream.frequency = frequency;
+    rate->period_values = 0;
+}
+
+static void xplane_rref_stats_reset(void* tapdata)
+{
+    xplane_rref_stats_t* stats = (xplane_rref_stats_t*)tapdata;
+
+    g_hash_table_remove_all(stats->streams);
+}
+
+static tap_packet_status xplane_rref_stats_packet(void* tapdata, packet_info* pinfo, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_rref_stats_t* stats = (xplane_rref_stats_t*)tapdata;
+    const xplane_rref_tap_info_t* tap_info = (const xplane_rref_tap_info_t*)data;
+    gdouble now = nstime_to_sec(&pinfo->rel_ts);
+
+    if (tap_info->request)
+    {
+        xplane_rref_rate_t* rate = (xplane_rref_rate_t*)xplane_rref_streams_get(stats->streams, sizeof(xplane_rref_rate_t), tap_info->client, tap_info->port, tap_info->id);
+        rate->requests++;
+        xplane_rref_stream_set_dataref(&rate->stream, tap_info->dataref, tap_info->dataref_id);
+        xplane_rref_rate_set_frequency(rate, tap_info->frequency);
+        return TAP_PACKET_REDRAW;
+    }
+
+    for (guint i = 0; i < tap_info->count; i++)
+    {
+        const xplane_rref_value_t* value = &tap_info->values[i];
+        xplane_rref_rate_t* rate = (xplane_rref_rate_t*)xplane_rref_streams_get(stats->streams, sizeof(xplane_rref_rate_t), tap_info->client, tap_info->port, value->id);
+        rate->values++;
+        xplane_rref_stream_set_dataref(&rate->stream, value->dataref, value->dataref_id);
+
+        // The dissector knows the rate in force even when the filter hid the request.
+        if (value->frequency >= 0)
+            xplane_rref_rate_set_frequency(rate, value->frequency);
+
+        if (rate->stream.frequency == 0)
+        {
+            rate->after_unsubscribe++;
+            continue;
+        }
+
+        if (rate->period_values == 0)
+        {
+            rate->period_first = now;
+        }
+        else if (rate->stream.frequency > 0)
+        {
+            // A gap of n periods means n - 1 values never arrived.
+            gdouble periods = (now - rate->period_last) * rate->stream.frequency;
+            if (periods >= 1.5)
+                rate->missing += (guint64)(periods + 0.5) - 1;
+        }
+        rate->period_values++;
+        rate->period_last = now;
+    }
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_rref_stats_draw(void* tapdata)
+{
+    const xplane_rref_stats_t* stats = (const xplane_rref_stats_t*)tapdata;
+    GPtrArray* sorted = xplane_rref_streams_sorted(stats->streams);
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane RREF Subscription Statistics:\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-50s %-28s %6s %8s %11s %10s %10s %12s\n", "Dataref", "Client", "Id", "Req Hz", "Achieved Hz", "Values", "Missing", "After Unsub");
+
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_rref_rate_t* rate = (const xplane_rref_rate_t*)g_ptr_array_index(sorted, i);
+        char achieved[16] = "-";
+
+        if (rate->period_values > 1 && rate->period_last > rate->period_first)
+            snprintf(achieved, sizeof achieved, "%.2f", (gdouble)(rate->period_values - 1) / (rate->period_last - rate->period_first));
+
+        xplane_rref_stream_print_start(&rate->stream);
+        printf(" %11s %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %12" G_GUINT64_FORMAT "\n", achieved, rate->values, rate->missing, rate->after_unsubscribe);
+    }
+    printf("=====================================================================================================================================\n");
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+static void xplane_rref_stats_finish(void* tapdata)
+{
+    xplane_rref_stats_t* stats = (xplane_rref_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->streams);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_rref_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,rref,";
+    xplane_rref_stats_t* stats = g_new0(xplane_rref_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+    stats->streams = xplane_rref_streams_new();
+
+    GString* error = register_tap_listener(xplane_RREF_TAP_NAME, stats, stats->filter, 0, xplane_rref_stats_reset, xplane_rref_stats_packet, xplane_rref_stats_draw, xplane_rref_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,rref tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_rref_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_rref_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,rref",
+    xplane_rref_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,jitter ----------
+/*
+   Intervals are kept in microseconds in a log bucketed histogram: each value
+   below 16 has its own bucket and every power of two above that is split into
+   8, so a bucket is never more than 12.5% wide and a fixed 496 buckets cover
+   any guint64. Percentiles report the top of the bucket they fall in.
+*/
+#define xplane_HISTOGRAM_LINEAR 16
+#define xplane_HISTOGRAM_SUB_BUCKETS 8
+#define xplane_HISTOGRAM_BUCKETS (xplane_HISTOGRAM_LINEAR + (64 - 4) * xplane_HISTOGRAM_SUB_BUCKETS)
+
+typedef struct xplane_histogram
+{
+    guint64 count;
+    guint64 max;
+    guint32 buckets[xplane_HISTOGRAM_BUCKETS];
+} xplane_histogram_t;
+
+static void xplane_histogram_add(xplane_histogram_t* histogram, guint64 value)
+{
+    guint bucket = (guint)value;
+    if (value >= xplane_HISTOGRAM_LINEAR)
+    {
+        int msb = ws_ilog2(value);
+        guint top = (guint)(value >> (msb - 3));    // 8..15
+        bucket = xplane_HISTOGRAM_LINEAR + (msb - 4) * xplane_HISTOGRAM_SUB_BUCKETS + (top - xplane_HISTOGRAM_SUB_BUCKETS);
+    }
+
+    histogram->count++;
+    if (value > histogram->max)
+        histogram->max = value;
+    if (histogram->buckets[bucket] < G_MAXUINT32)
+        histogram->buckets[bucket]++;
+}
+
+static void xplane_histogram_bucket_range(guint bucket, guint64* bottom, guint64* top)
+{
+    if (bucket < xplane_HISTOGRAM_LINEAR)
+    {
+        *bottom = *top = bucket;
+        return;
+    }
+
+    guint msb = (bucket - xplane_HISTOGRAM_LINEAR) / xplane_HISTOGRAM_SUB_BUCKETS + 4;
+    guint64 sub = (bucket - xplane_HISTOGRAM_LINEAR) % xplane_HISTOGRAM_SUB_BUCKETS + xplane_HISTOGRAM_SUB_BUCKETS;
+    *bottom = sub << (msb - 3);
+    *top = ((sub + 1) << (msb - 3)) - 1;
+}
+
+static guint64 xplane_histogram_percentile(const xplane_histogram_t* histogram, gdouble percentile)
+{
+    guint64 rank = (guint64)ceil(percentile / 100.0 * (gdouble)histogram->count);
+    guint64 seen = 0;
+
+    for (guint bucket = 0; bucket < xplane_HISTOGRAM_BUCKETS; bucket++)
+    {
+        seen += histogram->buckets[bucket];
+        if (seen < rank || histogram->buckets[bucket] == 0)
+            continue;
+
+        guint64 bottom, top;
+        xplane_histogram_bucket_range(bucket, &bottom, &top);
+        return MIN(top, histogram->max);
+    }
+    return histogram->max;
+}
+
+static void xplane_histogram_print(const xplane_histogram_t* histogram)
+{
+    if (histogram->count == 0)
+    {
+        printf(" %9s %9s %9s %9s", "-", "-", "-", "-");
+        return;
+    }
+    printf(" %9.3f %9.3f %9.3f %9.3f",
+        xplane_histogram_percentile(histogram, 50) / 1000.0,
+        xplane_histogram_percentile(histogram, 90) / 1000.0,
+        xplane_histogram_percentile(histogram, 99) / 1000.0,
+        histogram->max / 1000.0);
+}
+
+typedef struct xplane_rref_jitter
+{
+    xplane_rref_stream_t stream;
+    xplane_histogram_t intervals;   // time between values
+    xplane_histogram_t jitter;      // distance of each interval from the requested period
+} xplane_rref_jitter_t;
+
+typedef struct xplane_jitter_stats
+{
+    char* filter;
+    GHashTable* streams;            // xplane_rref_jitter_t
+} xplane_jitter_stats_t;
+
+static void xplane_jitter_stats_reset(void* tapdata)
+{
+    xplane_jitter_stats_t* stats = (xplane_jitter_stats_t*)tapdata;
+
+    g_hash_table_remove_all(stats->streams);
+}
+
+static tap_packet_status xplane_jitter_stats_packet(void* tapdata, packet_info* pinfo _U_, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_jitter_stats_t* stats = (xplane_jitter_stats_t*)tapdata;
+    const xplane_rref_tap_info_t* tap_info = (const xplane_rref_tap_info_t*)data;
+
+    // The dissector works out each value's interval, so requests add nothing.
+    if (tap_info->request)
+        return TAP_PACKET_DONT_REDRAW;
+
+    for (guint i = 0; i < tap_info->count; i++)
+    {
+        const xplane_rref_value_t* value = &tap_info->values[i];
+        xplane_rref_jitter_t* jitter = (xplane_rref_jitter_t*)xplane_rref_streams_get(stats->streams, sizeof(xplane_rref_jitter_t), tap_info->client, tap_info->port, value->id);
+        xplane_rref_stream_set_dataref(&jitter->stream, value->dataref, value->dataref_id);
+        if (value->frequency >= 0)
+            jitter->stream.frequency = value->frequency;
+
+        if (value->delta < 0)
+            continue;
+        xplane_histogram_add(&jitter->intervals, (guint64)(value->delta * 1e6 + 0.5));
+        if (value->frequency > 0)
+            xplane_histogram_add(&jitter->jitter, (guint64)(fabs(value->delta - 1.0 / value->frequency) * 1e6 + 0.5));
+    }
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_jitter_stats_draw(void* tapdata)
+{
+    const xplane_jitter_stats_t* stats = (const xplane_jitter_stats_t*)tapdata;
+    GPtrArray* sorted = xplane_rref_streams_sorted(stats->streams);
+
+    printf("\n");
+    printf("===================================================================================================================================================================\n");
+    printf("X-Plane RREF Jitter Statistics (ms):\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-50s %-28s %6s %8s %10s %9s %9s %9s %9s %9s %9s %9s %9s\n", "Dataref", "Client", "Id", "Req Hz", "Intervals",
+        "Int p50", "Int p90", "Int p99", "Int Max", "Jit p50", "Jit p90", "Jit p99", "Jit Max");
+
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_rref_jitter_t* jitter = (const xplane_rref_jitter_t*)g_ptr_array_index(sorted, i);
+
+        xplane_rref_stream_print_start(&jitter->stream);
+        printf(" %10" G_GUINT64_FORMAT, jitter->intervals.count);
+        xplane_histogram_print(&jitter->intervals);
+        xplane_histogram_print(&jitter->jitter);
+        printf("\n");
+    }
+    printf("===================================================================================================================================================================\n");
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+static void xplane_jitter_stats_finish(void* tapdata)
+{
+    xplane_jitter_stats_t* stats = (xplane_jitter_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->streams);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_jitter_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,jitter,";
+    xplane_jitter_stats_t* stats = g_new0(xplane_jitter_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+    stats->streams = xplane_rref_streams_new();
+
+    GString* error = register_tap_listener(xplane_RREF_TAP_NAME, stats, stats->filter, 0, xplane_jitter_stats_reset, xplane_jitter_stats_packet, xplane_jitter_stats_draw, xplane_jitter_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,jitter tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_jitter_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_jitter_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,jitter",
+    xplane_jitter_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,latency ----------
+typedef struct xplane_rref_request
+{
+    xplane_rref_stream_t stream;
+    gboolean pending;           // subscribed and no value seen since
+} xplane_rref_request_t;
+
+typedef struct xplane_latency_stats
+{
+    char* filter;
+    GHashTable* streams;        // xplane_rref_request_t
+    guint64 min;
+    xplane_histogram_t latency;
+} xplane_latency_stats_t;
+
+static void xplane_latency_stats_reset(void* tapdata)
+{
+    xplane_latency_stats_t* stats = (xplane_latency_stats_t*)tapdata;
+
+    g_hash_table_remove_all(stats->streams);
+    stats->min = 0;
+    memset(&stats->latency, 0, sizeof stats->latency);
+}
+
+static tap_packet_status xplane_latency_stats_packet(void* tapdata, packet_info* pinfo _U_, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_latency_stats_t* stats = (xplane_latency_stats_t*)tapdata;
+    const xplane_rref_tap_info_t* tap_info = (const xplane_rref_tap_info_t*)data;
+
+    if (tap_info->request)
+    {
+        xplane_rref_request_t* request = (xplane_rref_request_t*)xplane_rref_streams_get(stats->streams, sizeof(xplane_rref_request_t), tap_info->client, tap_info->port, tap_info->id);
+        xplane_rref_stream_set_dataref(&request->stream, tap_info->dataref, tap_info->dataref_id);
+        request->stream.frequency = tap_info->frequency;
+        request->pending = (tap_info->frequency > 0);
+        return TAP_PACKET_DONT_REDRAW;
+    }
+
+    for (guint i = 0; i < tap_info->count; i++)
+    {
+        const xplane_rref_value_t* value = &tap_info->values[i];
+        if (value->latency == NULL)
+            continue;
+
+        xplane_rref_request_t* request = (xplane_rref_request_t*)xplane_rref_streams_find(stats->streams, tap_info->client, tap_info->port, value->id);
+        if (request != NULL)
+            request->pending = FALSE;
+
+        gdouble latency = nstime_to_sec(value->latency);
+        guint64 microseconds = latency > 0 ? (guint64)(latency * 1e6 + 0.5) : 0;
+        if (stats->latency.count == 0 || microseconds < stats->min)
+            stats->min = microseconds;
+        xplane_histogram_add(&stats->latency, microseconds);
+    }
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_latency_stats_draw(void* tapdata)
+{
+    const xplane_latency_stats_t* stats = (const xplane_latency_stats_t*)tapdata;
+    const xplane_histogram_t* latency = &stats->latency;
+    guint pending = 0;
+    GHashTableIter iter;
+    gpointer request;
+
+    g_hash_table_iter_init(&iter, stats->streams);
+    while (g_hash_table_iter_next(&iter, &request, NULL))
+        pending += ((const xplane_rref_request_t*)request)->pending ? 1 : 0;
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane RREF Request to First Value Latency (ms):\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("Answered: %" G_GUINT64_FORMAT "  Still waiting: %u\n", latency->count, pending);
+    if (latency->count > 0)
+    {
+        printf("Min: %.3f  p50: %.3f  p90: %.3f  p99: %.3f  Max: %.3f\n", stats->min / 1000.0,
+            xplane_histogram_percentile(latency, 50) / 1000.0, xplane_histogram_percentile(latency, 90) / 1000.0,
+            xplane_histogram_percentile(latency, 99) / 1000.0, latency->max / 1000.0);
+        printf("\n%12s %12s %10s\n", "From", "To", "Count");
+        for (guint bucket = 0; bucket < xplane_HISTOGRAM_BUCKETS; bucket++)
+        {
+            guint64 bottom, top;
+            if (latency->buckets[bucket] == 0)
+                continue;
+            xplane_histogram_bucket_range(bucket, &bottom, &top);
+            printf("%12.3f %12.3f %10u\n", bottom / 1000.0, top / 1000.0, latency->buckets[bucket]);
+        }
+    }
+    printf("=====================================================================================================================================\n");
+}
+
+static void xplane_latency_stats_finish(void* tapdata)
+{
+    xplane_latency_stats_t* stats = (xplane_latency_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->streams);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_latency_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,latency,";
+    xplane_latency_stats_t* stats = g_new0(xplane_latency_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+    stats->streams = xplane_rref_streams_new();
+
+    GString* error = register_tap_listener(xplane_RREF_TAP_NAME, stats, stats->filter, 0, xplane_latency_stats_reset, xplane_latency_stats_packet, xplane_latency_stats_draw, xplane_latency_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,latency tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_latency_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_latency_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,latency",
+    xplane_latency_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,actions ----------
+typedef struct xplane_action_stats
+{
+    char* filter;
+    guint64 sent[xplane_ACTION_MESSAGE_COUNT];
+    guint64 min[xplane_ACTION_MESSAGE_COUNT];
+    xplane_histogram_t latency[xplane_ACTION_MESSAGE_COUNT];
+} xplane_action_stats_t;
+
+static void xplane_action_stats_reset(void* tapdata)
+{
+    xplane_action_stats_t* stats = (xplane_action_stats_t*)tapdata;
+
+    memset(stats->sent, 0, sizeof stats->sent);
+    memset(stats->min, 0, sizeof stats->min);
+    memset(stats->latency, 0, sizeof stats->latency);
+}
+
+static tap_packet_status xplane_action_stats_packet(void* tapdata, packet_info* pinfo _U_, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_action_stats_t* stats = (xplane_action_stats_t*)tapdata;
+    const xplane_action_tap_info_t* tap_info = (const xplane_action_tap_info_t*)data;
+    xplane_action_message_t message = tap_info->message;
+
+    if (message >= xplane_ACTION_MESSAGE_COUNT)
+        return TAP_PACKET_DONT_REDRAW;
+
+    if (tap_info->latency == NULL)
+    {
+        stats->sent[message]++;
+        return TAP_PACKET_REDRAW;
+    }
+
+    gdouble latency = nstime_to_sec(tap_info->latency);
+    guint64 microseconds = latency > 0 ? (guint64)(latency * 1e6 + 0.5) : 0;
+    if (stats->latency[message].count == 0 || microseconds < stats->min[message])
+        stats->min[message] = microseconds;
+    xplane_histogram_add(&stats->latency[message], microseconds);
+
+    return TAP_PACKET_REDRAW;
+}
+
+static void xplane_action_stats_draw(void* tapdata)
+{
+    const xplane_action_stats_t* stats = (const xplane_action_stats_t*)tapdata;
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane Control To Effect Latency (ms):\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-8s %10s %10s %10s %9s %9s %9s %9s %9s\n", "Message", "Sent", "Effect", "No Effect", "Min", "p50", "p90", "p99", "Max");
+
+    for (guint message = 0; message < xplane_ACTION_MESSAGE_COUNT; message++)
+    {
+        const xplane_histogram_t* latency = &stats->latency[message];
+        if (stats->sent[message] == 0 && latency->count == 0)
+            continue;
+
+        // A filter can let an effect through without its action.
+        guint64 no_effect = stats->sent[message] > latency->count ? stats->sent[message] - latency->count : 0;
+        printf("%-8s %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT, xplane_action_message_name((xplane_action_message_t)message), stats->sent[message], latency->count, no_effect);
+        if (latency->count > 0)
+            printf(" %9.3f", stats->min[message] / 1000.0);
+        else
+            printf(" %9s", "-");
+        xplane_histogram_print(latency);
+        printf("\n");
+    }
+    printf("=====================================================================================================================================\n");
+}
+
+static void xplane_action_stats_finish(void* tapdata)
+{
+    xplane_action_stats_t* stats = (xplane_action_stats_t*)tapdata;
+
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_action_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,actions,";
+    xplane_action_stats_t* stats = g_new0(xplane_action_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+
+    GString* error = register_tap_listener(xplane_ACTION_TAP_NAME, stats, stats->filter, 0, xplane_action_stats_reset, xplane_action_stats_packet, xplane_action_stats_draw, xplane_action_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,actions tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_action_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_action_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,actions",
+    xplane_action_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,flir ----------
+#define xplane_FLIR_MAX_FRAGMENTS 256     // frameindex and framecount are a byte
+
+typedef struct xplane_flir_stream
+{
+    address sim;
+    guint requests;
+    gdouble requested;          // last frame rate asked for, 0 if none seen
+    guint64 fragments;
+    guint64 bytes;
+    gdouble first;              // time of the first and last fragment
+    gdouble last;
+
+    guint64 complete;
+    guint64 complete_bytes;
+    gdouble first_complete;     // time the first and last complete frame finished
+    gdouble last_complete;
+    guint64 incomplete;
+    guint64 missing;            // fragments of incomplete frames that never arrived
+
+    // The last frame seen, still being received while open.
+    guint32 frame;              // 0 before the first fragment
+    gboolean open;
+    guint32 framecount;
+    guint32 received;
+    guint64 frame_bytes;
+    guint64 seen[xplane_FLIR_MAX_FRAGMENTS / 64];  // bit n set once fragment n arrived
+} xplane_flir_stream_t;
+
+typedef struct xplane_flir_stats
+{
+    char* filter;
+    GHashTable* streams;        // xplane_flir_stream_t, keyed by its sim address
+} xplane_flir_stats_t;
+
+static guint xplane_flir_stream_hash(gconstpointer key)
+{
+    return add_address_to_hash(0, &((const xplane_flir_stream_t*)key)->sim);
+}
+
+static gboolean xplane_flir_stream_equal(gconstpointer a, gconstpointer b)
+{
+    return addresses_equal(&((const xplane_flir_stream_t*)a)->sim, &((const xplane_flir_stream_t*)b)->sim);
+}
+
+static void xplane_flir_stream_free(gpointer data)
+{
+    xplane_flir_stream_t* stream = (xplane_flir_stream_t*)data;
+
+    free_address(&stream->sim);
+    g_free(stream);
+}
+
+static xplane_flir_stream_t* xplane_flir_stream_get(GHashTable* streams, const address* sim)
+{
+    xplane_flir_stream_t key;
+    key.sim = *sim;
+
+    xplane_flir_stream_t* stream = (xplane_flir_stream_t*)g_hash_table_lookup(streams, &key);
+    if (stream == NULL)
+    {
+        stream = g_new0(xplane_flir_stream_t, 1);
+        copy_address(&stream->sim, sim);
+        g_hash_table_insert(streams, stream, stream);
+    }
+    return stream;
+}
+
+// Adds the frame being received to the totals, as complete or incomplete, at time now.
+static void xplane_flir_stream_end_frame(xplane_flir_stream_t* stream, gdouble now)
+{
+    if (!stream->open)
+        return;
+
+    if (stream->received >= stream->framecount)
+    {
+        if (stream->complete == 0)
+            stream->first_complete = now;
+        stream->last_complete = now;
+        stream->complete++;
+        stream->complete_bytes += stream->frame_bytes;
+    }
+    else
+    {
+        stream->incomplete++;
+        stream->missing += stream->framecount - stream->received;
+    }
+    stream->open = FALSE;
+}
+
+static void xplane_flir_stats_reset(void* tapdata)
+{
+    xplane_flir_stats_t* stats = (xplane_flir_stats_t*)tapdata;
+
+    g_hash_table_remove_all(stats->streams);
+}
+
+static tap_packet_status xplane_flir_stats_packet(void* tapdata, packet_info* pinfo, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_flir_stats_t* stats = (xplane_flir_stats_t*)tapdata;
+    const xplane_flir_tap_info_t* tap_info = (const xplane_flir_tap_info_t*)data;
+    xplane_flir_stream_t* stream = xplane_flir_stream_get(stats->streams, tap_info->sim);
+    gdouble now = nstime_to_sec(&pinfo->rel_ts);
+
+    if (tap_info->request)
+    {
+        stream->requests++;
+        stream->requested = tap_info->framerate;
+        return TAP_PACKET_REDRAW;
+    }
+
+    if (stream->fragments == 0)
+        stream->first = now;
+    stream->last = now;
+    stream->fragments++;
+    stream->bytes += tap_info->length;
+
+    if (tap_info->frame != stream->frame)
+    {
+        xplane_flir_stream_end_frame(stream, now);
+        stream->frame = tap_info->frame;
+        stream->open = TRUE;
+        stream->framecount = tap_info->framecount;
+        stream->received = 0;
+        stream->frame_bytes = 0;
+        memset(stream->seen, 0, sizeof stream->seen);
+    }
+
+    // A repeated fragment is counted in the bandwidth but not twice towards its frame.
+    guint32 index = tap_info->frameindex;
+    guint64 bit = G_GUINT64_CONSTANT(1) << (index % 64);
+    if (stream->open && index < xplane_FLIR_MAX_FRAGMENTS && !(stream->seen[index / 64] & bit))
+    {
+        stream->seen[index / 64] |= bit;
+        stream->received++;
+        stream->frame_bytes += tap_info->length;
+    }
+
+    // End a frame as soon as it is whole so the delivered rate uses the time it completed.
+    if (stream->open && stream->received >= stream->framecount)
+        xplane_flir_stream_end_frame(stream, now);
+
+    return TAP_PACKET_REDRAW;
+}
+
+static gint xplane_flir_stream_compare(gconstpointer a, gconstpointer b)
+{
+    const xplane_flir_stream_t* stream_a = *(const xplane_flir_stream_t* const*)a;
+    const xplane_flir_stream_t* stream_b = *(const xplane_flir_stream_t* const*)b;
+    return cmp_address(&stream_a->sim, &stream_b->sim);
+}
+
+static void xplane_flir_stats_draw(void* tapdata)
+{
+    const xplane_flir_stats_t* stats = (const xplane_flir_stats_t*)tapdata;
+    GPtrArray* sorted = g_ptr_array_sized_new(g_hash_table_size(stats->streams));
+    GHashTableIter iter;
+    gpointer entry;
+
+    g_hash_table_iter_init(&iter, stats->streams);
+    while (g_hash_table_iter_next(&iter, &entry, NULL))
+        g_ptr_array_add(sorted, entry);
+    g_ptr_array_sort(sorted, xplane_flir_stream_compare);
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane FLIR Stream Statistics:\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-40s %9s %9s %10s %10s %10s %10s %12s %10s\n", "Simulator", "Req fps", "Got fps", "Frames", "Incomplete", "Missing", "Fragments", "Bytes/Frame", "kB/s");
+
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        // A frame still open at the end of the capture never completed; count it without changing the stream.
+        xplane_flir_stream_t stream = *(const xplane_flir_stream_t*)g_ptr_array_index(sorted, i);
+        xplane_flir_stream_end_frame(&stream, stream.last);
+
+        char* sim = address_to_str(NULL, &stream.sim);
+        char requested[16] = "-";
+        char delivered[16] = "-";
+        char per_frame[24] = "-";
+        char bandwidth[16] = "-";
+
+        if (stream.requests > 0)
+            snprintf(requested, sizeof requested, "%.2f", stream.requested);
+        if (stream.complete > 1 && stream.last_complete > stream.first_complete)
+            snprintf(delivered, sizeof delivered, "%.2f", (gdouble)(stream.complete - 1) / (stream.last_complete - stream.first_complete));
+        if (stream.complete > 0)
+            snprintf(per_frame, sizeof per_frame, "%" G_GUINT64_FORMAT, stream.complete_bytes / stream.complete);
+        if (stream.last > stream.first)
+            snprintf(bandwidth, sizeof bandwidth, "%.1f", stream.bytes / (stream.last - stream.first) / 1000.0);
+
+        printf("%-40.40s %9s %9s %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %12s %10s\n",
+            sim, requested, delivered, stream.complete, stream.incomplete, stream.missing, stream.fragments, per_frame, bandwidth);
+        wmem_free(NULL, sim);
+    }
+    printf("=====================================================================================================================================\n");
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+static void xplane_flir_stats_finish(void* tapdata)
+{
+    xplane_flir_stats_t* stats = (xplane_flir_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->streams);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_flir_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,flir,";
+    xplane_flir_stats_t* stats = g_new0(xplane_flir_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+    // Keys and values are the same entry, so it's only freed once.
+    stats->streams = g_hash_table_new_full(xplane_flir_stream_hash, xplane_flir_stream_equal, NULL, xplane_flir_stream_free);
+
+    GString* error = register_tap_listener(xplane_FLIR_TAP_NAME, stats, stats->filter, 0, xplane_flir_stats_reset, xplane_flir_stats_packet, xplane_flir_stats_draw, xplane_flir_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,flir tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_flir_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_flir_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,flir",
+    xplane_flir_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,radr ----------
+#define xplane_RADR_CELL_DEGREES 0.1
+#define xplane_RADR_MAP_COLUMNS 120
+#define xplane_RADR_MAP_ROWS 60
+
+typedef struct xplane_radr_cell
+{
+    gint64 key;                 // row << 32 | column, see xplane_radr_cell_key
+    gint32 row;                 // floor(latitude / cell size)
+    gint32 column;              // floor(longitude / cell size)
+    guint64 points;
+    gint8 precipitation;
+    gfloat height;
+} xplane_radr_cell_t;
+
+typedef struct xplane_radr_stats
+{
+    char* filter;
+    gboolean csv;
+    gdouble cell_degrees;
+    guint64 points;
+    guint64 rejected;           // points off the globe or not numbers
+    GHashTable* cells;          // xplane_radr_cell_t, keyed by its key
+} xplane_radr_stats_t;
+
+static gint64 xplane_radr_cell_key(gint32 row, gint32 column)
+{
+    return (gint64)(((guint64)(guint32)row << 32) | (guint32)column);
+}
+
+static void xplane_radr_stats_reset(void* tapdata)
+{
+    xplane_radr_stats_t* stats = (xplane_radr_stats_t*)tapdata;
+
+    stats->points = 0;
+    stats->rejected = 0;
+    g_hash_table_remove_all(stats->cells);
+}
+
+static tap_packet_status xplane_radr_stats_packet(void* tapdata, packet_info* pinfo _U_, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_radr_stats_t* stats = (xplane_radr_stats_t*)tapdata;
+    const xplane_radr_tap_info_t* tap_info = (const xplane_radr_tap_info_t*)data;
+
+    for (guint i = 0; i < tap_info->count; i++)
+    {
+        const xplane_radr_point_t* point = &tap_info->points[i];
+
+        // The range checks are false for NaN too.
+        if (!(point->latitude >= -90 && point->latitude <= 90 && point->longitude >= -180 && point->longitude <= 180))
+        {
+            stats->rejected++;
+            continue;
+        }
+        stats->points++;
+
+        gint32 row = (gint32)floor(point->latitude / stats->cell_degrees);
+        gint32 column = (gint32)floor(point->longitude / stats->cell_degrees);
+        gint64 key = xplane_radr_cell_key(row, column);
+
+        xplane_radr_cell_t* cell = (xplane_radr_cell_t*)g_hash_table_lookup(stats->cells, &key);
+        if (cell == NULL)
+        {
+            cell = g_new0(xplane_radr_cell_t, 1);
+            cell->key = key;
+            cell->row = row;
+            cell->column = column;
+            cell->precipitation = point->precipitation;
+            cell->height = point->height;
+            g_hash_table_insert(stats->cells, &cell->key, cell);
+        }
+        cell->points++;
+        cell->precipitation = MAX(cell->precipitation, point->precipitation);
+        if (point->height > cell->height)
+            cell->height = point->height;
+    }
+
+    return TAP_PACKET_REDRAW;
+}
+
+// North first, then west to east.
+static gint xplane_radr_cell_compare(gconstpointer a, gconstpointer b)
+{
+    const xplane_radr_cell_t* cell_a = *(const xplane_radr_cell_t* const*)a;
+    const xplane_radr_cell_t* cell_b = *(const xplane_radr_cell_t* const*)b;
+
+    if (cell_a->row != cell_b->row)
+        return cell_a->row > cell_b->row ? -1 : 1;
+    return cell_a->column < cell_b->column ? -1 : cell_a->column > cell_b->column;
+}
+
+static void xplane_radr_stats_print_csv(const xplane_radr_stats_t* stats, const GPtrArray* sorted)
+{
+    printf("latitude,longitude,points,max_precipitation,max_height_m\n");
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_radr_cell_t* cell = (const xplane_radr_cell_t*)g_ptr_array_index(sorted, i);
+        printf("%.4f,%.4f,%" G_GUINT64_FORMAT ",%d,%.0f\n", (cell->row + 0.5) * stats->cell_degrees, (cell->column + 0.5) * stats->cell_degrees,
+            cell->points, cell->precipitation, cell->height);
+    }
+}
+
+/*
+   One character per cell, from '.' for no precipitation to '@' for 100, left blank
+   where no points landed. Areas too big for the map are scaled down, each
+   character showing the wettest of the cells it covers.
+*/
+static void xplane_radr_stats_print_map(const xplane_radr_stats_t* stats, const GPtrArray* sorted)
+{
+    static const char ramp[] = ".:-=+*#%@";
+    gint32 top = G_MININT32, bottom = G_MAXINT32, left = G_MAXINT32, right = G_MININT32;
+
+    if (sorted->len == 0)
+        return;
+
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_radr_cell_t* cell = (const xplane_radr_cell_t*)g_ptr_array_index(sorted, i);
+        top = MAX(top, cell->row);
+        bottom = MIN(bottom, cell->row);
+        left = MIN(left, cell->column);
+        right = MAX(right, cell->column);
+    }
+
+    guint rows = (guint)(top - bottom) + 1;
+    guint columns = (guint)(right - left) + 1;
+    guint scale = MAX((columns + xplane_RADR_MAP_COLUMNS - 1) / xplane_RADR_MAP_COLUMNS, (rows + xplane_RADR_MAP_ROWS - 1) / xplane_RADR_MAP_ROWS);
+    guint map_rows = (rows + scale - 1) / scale;
+    guint map_columns = (columns + scale - 1) / scale;
+
+    // -1 is a character with no points.
+    gint8* map = (gint8*)g_malloc(map_rows * map_columns);
+    memset(map, -1, map_rows * map_columns);
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_radr_cell_t* cell = (const xplane_radr_cell_t*)g_ptr_array_index(sorted, i);
+        gint8* character = &map[((guint)(top - cell->row) / scale) * map_columns + (guint)(cell->column - left) / scale];
+        *character = MAX(*character, MAX(cell->precipitation, 0));
+    }
+
+    printf("North %.4f, South %.4f, West %.4f, East %.4f, %.4f degrees per character\n",
+        (top + 1) * stats->cell_degrees, bottom * stats->cell_degrees, left * stats->cell_degrees, (right + 1) * stats->cell_degrees, scale * stats->cell_degrees);
+    for (guint r = 0; r < map_rows; r++)
+    {
+        putchar('|');
+        for (guint c = 0; c < map_columns; c++)
+        {
+            gint8 precipitation = map[r * map_columns + c];
+            if (precipitation < 0)
+                putchar(' ');
+            else
+                putchar(ramp[MIN(precipitation, 100) * (guint)(sizeof ramp - 2) / 100]);
+        }
+        printf("|\n");
+    }
+    g_free(map);
+}
+
+static void xplane_radr_stats_draw(void* tapdata)
+{
+    const xplane_radr_stats_t* stats = (const xplane_radr_stats_t*)tapdata;
+    GPtrArray* sorted = g_ptr_array_sized_new(g_hash_table_size(stats->cells));
+    GHashTableIter iter;
+    gpointer cell;
+
+    g_hash_table_iter_init(&iter, stats->cells);
+    while (g_hash_table_iter_next(&iter, NULL, &cell))
+        g_ptr_array_add(sorted, cell);
+    g_ptr_array_sort(sorted, xplane_radr_cell_compare);
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane RADR Weather Grid:\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("Points: %" G_GUINT64_FORMAT " (%" G_GUINT64_FORMAT " off the globe), Cells: %u of %.4f degrees\n", stats->points, stats->rejected, sorted->len, stats->cell_degrees);
+    if (stats->csv)
+        xplane_radr_stats_print_csv(stats, sorted);
+    else
+        xplane_radr_stats_print_map(stats, sorted);
+    printf("=====================================================================================================================================\n");
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+static void xplane_radr_stats_finish(void* tapdata)
+{
+    xplane_radr_stats_t* stats = (xplane_radr_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->cells);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+// Takes the next comma separated option off *options if it is one of the output formats or a cell size.
+static gboolean xplane_radr_stats_option(const char** options, xplane_radr_stats_t* stats)
+{
+    const char* option = *options;
+    const char* end = strchr(option, ',');
+    gsize length = end ? (gsize)(end - option) : strlen(option);
+    char* parsed = NULL;
+
+    if (length == 5 && strncmp(option, "ascii", 5) == 0)
+        stats->csv = FALSE;
+    else if (length == 3 && strncmp(option, "csv", 3) == 0)
+        stats->csv = TRUE;
+    else
+    {
+        gdouble degrees = g_ascii_strtod(option, &parsed);
+        if (parsed != option + length || !(degrees >= 0.001 && degrees <= 90))
+            return FALSE;
+        stats->cell_degrees = degrees;
+    }
+
+    *options = end ? end + 1 : option + length;
+    return TRUE;
+}
+
+static void xplane_radr_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,radr,";
+    xplane_radr_stats_t* stats = g_new0(xplane_radr_stats_t, 1);
+    stats->cell_degrees = xplane_RADR_CELL_DEGREES;
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+    {
+        const char* options = opt_arg + strlen(prefix);
+        if (xplane_radr_stats_option(&options, stats) && *options != '\0')
+            xplane_radr_stats_option(&options, stats);
+        if (*options != '\0')
+            stats->filter = g_strdup(options);
+    }
+    stats->cells = g_hash_table_new_full(g_int64_hash, g_int64_equal, NULL, g_free);
+
+    GString* error = register_tap_listener(xplane_RADR_TAP_NAME, stats, stats->filter, 0, xplane_radr_stats_reset, xplane_radr_stats_packet, xplane_radr_stats_draw, xplane_radr_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,radr tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_radr_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_radr_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,radr",
+    xplane_radr_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,track ----------
+#define xplane_TRACK_CHUNK 128
+
+typedef enum
+{
+    xplane_TRACK_CSV,
+    xplane_TRACK_KML,
+    xplane_TRACK_GPX
+} xplane_track_format_t;
+
+// An aircraft's samples since they were last written, as parallel arrays.
+typedef struct xplane_track
+{
+    guint segment;              // segment the samples belong to, from 1
+    guint count;
+    guint64 samples;
+    guint64 segment_samples;    // samples in the current segment
+    FILE* points;               // KML and GPX: the segment's points written so far, NULL before the first
+    char* points_name;
+    gdouble time[xplane_TRACK_CHUNK];     // seconds since the epoch
+    gdouble latitude[xplane_TRACK_CHUNK];
+    gdouble longitude[xplane_TRACK_CHUNK];
+    gdouble elevation[xplane_TRACK_CHUNK];
+    gfloat heading[xplane_TRACK_CHUNK];
+    gfloat pitch[xplane_TRACK_CHUNK];
+    gfloat roll[xplane_TRACK_CHUNK];
+} xplane_track_t;
+
+typedef struct xplane_track_sim
+{
+    address sim;
+    char* name;
+    xplane_track_t* aircraft[xplane_AIRCRAFT_SLOTS];    // NULL until the slot is seen
+} xplane_track_sim_t;
+
+typedef struct xplane_track_stats
+{
+    char* filter;
+    char* filename;
+    xplane_track_format_t format;
+    FILE* file;
+    GPtrArray* sims;            // xplane_track_sim_t, in the order they were seen
+} xplane_track_stats_t;
+
+static void xplane_track_sim_free(gpointer data)
+{
+    xplane_track_sim_t* sim = (xplane_track_sim_t*)data;
+
+    for (guint a = 0; a < xplane_AIRCRAFT_SLOTS; a++)
+    {
+        xplane_track_t* track = sim->aircraft[a];
+        if (track == NULL)
+            continue;
+        if (track->points != NULL)
+        {
+            fclose(track->points);
+            ws_unlink(track->points_name);
+        }
+        g_free(track->points_name);
+        g_free(track);
+    }
+    wmem_free(NULL, sim->name);
+    free_address(&sim->sim);
+    g_free(sim);
+}
+
+static void xplane_track_print_angle(FILE* file, gfloat angle)
+{
+    if (angle == angle)
+        fprintf(file, ",%.2f", angle);
+    else
+        fputc(',', file);
+}
+
+static void xplane_track_print_time(FILE* file, gdouble time)
+{
+    gdouble seconds = floor(time);
+    GDateTime* date_time = g_date_time_new_from_unix_utc((gint64)seconds);
+    gchar* text = g_date_time_format(date_time, "%Y-%m-%dT%H:%M:%S");
+
+    fprintf(file, "%s.%03dZ", text, (int)((time - seconds) * 1000));
+    g_free(text);
+    g_date_time_unref(date_time);
+}
+
+static void xplane_track_write_header(const xplane_track_stats_t* stats)
+{
+    switch (stats->format)
+    {
+    case xplane_TRACK_CSV:
+        fprintf(stats->file, "sim,aircraft,segment,time,latitude,longitude,elevation_m,heading,pitch,roll\n");
+        break;
+    case xplane_TRACK_KML:
+        fprintf(stats->file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<kml xmlns=\"http://www.opengis.net/kml/2.2\">\n<Document>\n<name>X-Plane tracks</name>\n");
+        break;
+    case xplane_TRACK_GPX:
+        fprintf(stats->file, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<gpx version=\"1.1\" creator=\"Wireshark X-Plane dissector\" xmlns=\"http://www.topografix.com/GPX/1/1\">\n");
+        break;
+    }
+}
+
+static void xplane_track_write_footer(const xplane_track_stats_t* stats)
+{
+    if (stats->format == xplane_TRACK_KML)
+        fprintf(stats->file, "</Document>\n</kml>\n");
+    else if (stats->format == xplane_TRACK_GPX)
+        fprintf(stats->file, "</gpx>\n");
+}
+
+// Copies a KML or GPX segment's spooled points to the file as one element and starts the next segment's spool afresh.
+static void xplane_track_write_segment(const xplane_track_stats_t* stats, const xplane_track_sim_t* sim, guint aircraft, xplane_track_t* track)
+{
+    FILE* file = stats->file;
+    char buffer[4096];
+    size_t length;
+
+    if (track->points == NULL)
+        return;
+
+    if (stats->format == xplane_TRACK_KML)
+    {
+        fprintf(file, "<Placemark>\n<name>%s aircraft %u segment %u</name>\n", sim->name, aircraft, track->segment);
+        fprintf(file, track->segment_samples > 1 ? "<LineString>\n<altitudeMode>absolute</altitudeMode>\n<coordinates>\n" : "<Point>\n<altitudeMode>absolute</altitudeMode>\n<coordinates>\n");
+    }
+    else
+    {
+        fprintf(file, "<trk>\n<name>%s aircraft %u segment %u</name>\n<number>%u</number>\n<trkseg>\n", sim->name, aircraft, track->segment, track->segment);
+    }
+
+    rewind(track->points);
+    while ((length = fread(buffer, 1, sizeof buffer, track->points)) > 0)
+        fwrite(buffer, 1, length, file);
+
+    if (stats->format == xplane_TRACK_KML)
+        fprintf(file, track->segment_samples > 1 ? "</coordinates>\n</LineString>\n</Placemark>\n" : "</coordinates>\n</Point>\n</Placemark>\n");
+    else
+        fprintf(file, "</trkseg>\n</trk>\n");
+
+    fclose(track->points);
+    ws_unlink(track->points_name);
+    g_free(track->points_name);
+    track->points = NULL;
+    track->points_name = NULL;
+}
+
+static FILE* xplane_track_spool(xplane_track_t* track)
+{
+    GError* error = NULL;
+
+    if (track->points != NULL)
+        return track->points;
+
+    int fd = create_tempfile(NULL, &track->points_name, "wireshark_xplane_track", NULL, &error);
+    if (fd == -1)
+    {
+        fprintf(stderr, "tshark: Couldn't create a temporary file for xplane,track: %s\n", error->message);
+        g_error_free(error);
+        return NULL;
+    }
+    track->points = ws_fdopen(fd, "w+b");
+    if (track->points == NULL)
+    {
+        fprintf(stderr, "tshark: Couldn't open %s for xplane,track: %s\n", track->points_name, g_strerror(errno));
+        ws_close(fd);
+        ws_unlink(track->points_name);
+        g_free(track->points_name);
+        track->points_name = NULL;
+    }
+    return track->points;
+}
+
+// Writes an aircraft's buffered samples, or spools them for KML and GPX, and empties the buffer; a segment that ends is completed.
+static void xplane_track_flush(const xplane_track_stats_t* stats, const xplane_track_sim_t* sim, guint aircraft, xplane_track_t* track, gboolean segment_ends)
+{
+    // CSV rows go straight to the file, KML and GPX points to the segment's spool.
+    FILE* file = stats->file;
+    if (file != NULL && track->count > 0 && stats->format != xplane_TRACK_CSV)
+        file = xplane_track_spool(track);
+
+    if (file != NULL && track->count > 0)
+    {
+        switch (stats->format)
+        {
+        case xplane_TRACK_CSV:
+            for (guint i = 0; i < track->count; i++)
+            {
+                fprintf(file, "%s,%u,%u,%.3f,%.7f,%.7f,%.1f", sim->name, aircraft, track->segment, track->time[i], track->latitude[i], track->longitude[i], track->elevation[i]);
+                xplane_track_print_angle(file, track->heading[i]);
+                xplane_track_print_angle(file, track->pitch[i]);
+                xplane_track_print_angle(file, track->roll[i]);
+                fputc('\n', file);
+            }
+            break;
+        case xplane_TRACK_KML:
+            for (guint i = 0; i < track->count; i++)
+                fprintf(file, "%.7f,%.7f,%.1f\n", track->longitude[i], track->latitude[i], track->elevation[i]);
+            break;
+        case xplane_TRACK_GPX:
+            for (guint i = 0; i < track->count; i++)
+            {
+                fprintf(file, "<trkpt lat=\"%.7f\" lon=\"%.7f\"><ele>%.1f</ele><time>", track->latitude[i], track->longitude[i], track->elevation[i]);
+                xplane_track_print_time(file, track->time[i]);
+                fprintf(file, "</time></trkpt>\n");
+            }
+            break;
+        }
+    }
+    track->count = 0;
+
+    if (segment_ends)
+    {
+        if (stats->file != NULL)
+            xplane_track_write_segment(stats, sim, aircraft, track);
+        track->segment_samples = 0;
+    }
+}
+
+static void xplane_track_flush_all(const xplane_track_stats_t* stats)
+{
+    for (guint s = 0; s < stats->sims->len; s++)
+    {
+        xplane_track_sim_t* sim = (xplane_track_sim_t*)g_ptr_array_index(stats->sims, s);
+        for (guint a = 0; a < xplane_AIRCRAFT_SLOTS; a++)
+        {
+            if (sim->aircraft[a] != NULL)
+                xplane_track_flush(stats, sim, a, sim->aircraft[a], TRUE);
+        }
+    }
+}
+
+static gboolean xplane_track_open(xplane_track_stats_t* stats)
+{
+    stats->file = ws_fopen(stats->filename, "w");
+    if (stats->file == NULL)
+    {
+        fprintf(stderr, "tshark: Couldn't open %s for xplane,track: %s\n", stats->filename, g_strerror(errno));
+        return FALSE;
+    }
+    xplane_track_write_header(stats);
+    return TRUE;
+}
+
+// Starts the file again if the capture is re-read after anything was tracked.
+static void xplane_track_stats_reset(void* tapdata)
+{
+    xplane_track_stats_t* stats = (xplane_track_stats_t*)tapdata;
+
+    if (stats->sims->len == 0)
+        return;
+    g_ptr_array_set_size(stats->sims, 0);
+    if (stats->file != NULL)
+        fclose(stats->file);
+    xplane_track_open(stats);
+}
+
+static tap_packet_status xplane_track_stats_packet(void* tapdata, packet_info* pinfo, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_track_stats_t* stats = (xplane_track_stats_t*)tapdata;
+    const xplane_position_tap_info_t* tap_info = (const xplane_position_tap_info_t*)data;
+    xplane_track_sim_t* sim = NULL;
+
+    if (stats->file == NULL || tap_info->aircraft < 0 || tap_info->aircraft >= xplane_AIRCRAFT_SLOTS)
+        return TAP_PACKET_DONT_REDRAW;
+
+    // A handful of simulators at most, so a list is enough.
+    for (guint s = 0; s < stats->sims->len && sim == NULL; s++)
+    {
+        xplane_track_sim_t* candidate = (xplane_track_sim_t*)g_ptr_array_index(stats->sims, s);
+        if (addresses_equal(&candidate->sim, tap_info->sim))
+            sim = candidate;
+    }
+    if (sim == NULL)
+    {
+        sim = g_new0(xplane_track_sim_t, 1);
+        copy_address(&sim->sim, tap_info->sim);
+        sim->name = address_to_str(NULL, tap_info->sim);
+        g_ptr_array_add(stats->sims, sim);
+    }
+
+    xplane_track_t* track = sim->aircraft[tap_info->aircraft];
+    if (track == NULL)
+    {
+        track = g_new0(xplane_track_t, 1);
+        track->segment = 1;
+        sim->aircraft[tap_info->aircraft] = track;
+    }
+
+    if (tap_info->reposition)
+    {
+        xplane_track_flush(stats, sim, tap_info->aircraft, track, TRUE);
+        if (track->samples > 0)
+            track->segment++;
+        if (!tap_info->known_position)
+            return TAP_PACKET_REDRAW;
+    }
+
+    if (!(tap_info->latitude >= -90 && tap_info->latitude <= 90 && tap_info->longitude >= -180 && tap_info->longitude <= 180))
+        return TAP_PACKET_DONT_REDRAW;
+
+    if (track->count == xplane_TRACK_CHUNK)
+        xplane_track_flush(stats, sim, tap_info->aircraft, track, FALSE);
+
+    guint i = track->count++;
+    track->time[i] = nstime_to_sec(&pinfo->abs_ts);
+    track->latitude[i] = tap_info->latitude;
+    track->longitude[i] = tap_info->longitude;
+    track->elevation[i] = tap_info->elevation;
+    track->heading[i] = (gfloat)tap_info->heading;
+    track->pitch[i] = (gfloat)tap_info->pitch;
+    track->roll[i] = (gfloat)tap_info->roll;
+    track->samples++;
+    track->segment_samples++;
+
+    return TAP_PACKET_REDRAW;
+}
+
+// The file is completed here, as draw is the last call tshark is sure to make.
+static void xplane_track_stats_draw(void* tapdata)
+{
+    xplane_track_stats_t* stats = (xplane_track_stats_t*)tapdata;
+
+    xplane_track_flush_all(stats);
+    if (stats->file != NULL)
+    {
+        xplane_track_write_footer(stats);
+        fclose(stats->file);
+        stats->file = NULL;
+    }
+
+    printf("\n");
+    printf("=====================================================================================================================================\n");
+    printf("X-Plane Aircraft Tracks written to %s:\n", stats->filename);
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-40s %8s %10s %12s\n", "Simulator", "Aircraft", "Segments", "Samples");
+    for (guint s = 0; s < stats->sims->len; s++)
+    {
+        const xplane_track_sim_t* sim = (const xplane_track_sim_t*)g_ptr_array_index(stats->sims, s);
+        for (guint a = 0; a < xplane_AIRCRAFT_SLOTS; a++)
+        {
+            const xplane_track_t* track = sim->aircraft[a];
+            if (track != NULL && track->samples > 0)
+                printf("%-40.40s %8u %10u %12" G_GUINT64_FORMAT "\n", sim->name, a, track->segment, track->samples);
+        }
+    }
+    printf("=====================================================================================================================================\n");
+}
+
+static void xplane_track_stats_finish(void* tapdata)
+{
+    xplane_track_stats_t* stats = (xplane_track_stats_t*)tapdata;
+
+    if (stats->file != NULL)
+    {
+        xplane_track_flush_all(stats);
+        xplane_track_write_footer(stats);
+        fclose(stats->file);
+    }
+    g_ptr_array_free(stats->sims, TRUE);
+    g_free(stats->filename);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_track_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,track,";
+    static const char* const formats[] = { "csv", "kml", "gpx" };
+    xplane_track_stats_t* stats = g_new0(xplane_track_stats_t, 1);
+    gchar** options = NULL;
+    gboolean known_format = FALSE;
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        options = g_strsplit(opt_arg + strlen(prefix), ",", 3);
+    if (options != NULL && options[0] != NULL)
+    {
+        for (guint f = 0; f < G_N_ELEMENTS(formats); f++)
+        {
+            if (g_ascii_strcasecmp(options[0], formats[f]) == 0)
+            {
+                stats->format = (xplane_track_format_t)f;
+                known_format = TRUE;
+            }
+        }
+    }
+    if (!known_format || options[1] == NULL || options[1][0] == '\0')
+    {
+        fprintf(stderr, "tshark: invalid \"-z xplane,track,csv|kml|gpx,file[,filter]\" argument\n");
+        g_strfreev(options);
+        g_free(stats);
+        return;
+    }
+    stats->filename = g_strdup(options[1]);
+    if (options[2] != NULL)
+        stats->filter = g_strdup(options[2]);
+    g_strfreev(options);
+    stats->sims = g_ptr_array_new_with_free_func(xplane_track_sim_free);
+    if (!xplane_track_open(stats))
+    {
+        xplane_track_stats_finish(stats);
+        return;
+    }
+
+    GString* error = register_tap_listener(xplane_POSITION_TAP_NAME, stats, stats->filter, 0, xplane_track_stats_reset, xplane_track_stats_packet, xplane_track_stats_draw, xplane_track_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,track tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_track_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_track_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,track",
+    xplane_track_stats_init,
+    0,
+    NULL
+};
+
+// ---------- -z xplane,conformance ----------
+typedef struct xplane_conformance_stream
+{
+    address sim;
+    address client;
+    guint32 port;
+    xplane_stream_t stream;
+    guint64 samples;
+    guint64 counts[xplane_INTERVAL_BURST + 1];  // intervals of each xplane_interval_t
+    guint64 missing;
+    gdouble period;             // the latest expected period, 0 if never known
+    gboolean requested;
+    gdouble longest;            // longest interval, seconds
+} xplane_conformance_stream_t;
+
+typedef struct xplane_conformance_stats
+{
+    char* filter;
+    GHashTable* streams;        // xplane_conformance_stream_t, keyed by its sim, client, port and stream
+} xplane_conformance_stats_t;
+
+static guint xplane_conformance_stream_hash(gconstpointer key)
+{
+    const xplane_conformance_stream_t* stream = (const xplane_conformance_stream_t*)key;
+    return add_address_to_hash(add_address_to_hash(stream->port ^ ((guint)stream->stream << 16), &stream->sim), &stream->client);
+}
+
+static gboolean xplane_conformance_stream_equal(gconstpointer a, gconstpointer b)
+{
+    const xplane_conformance_stream_t* stream_a = (const xplane_conformance_stream_t*)a;
+    const xplane_conformance_stream_t* stream_b = (const xplane_conformance_stream_t*)b;
+    return stream_a->stream == stream_b->stream && stream_a->port == stream_b->port &&
+        addresses_equal(&stream_a->sim, &stream_b->sim) && addresses_equal(&stream_a->client, &stream_b->client);
+}
+
+static void xplane_conformance_stream_free(gpointer data)
+{
+    xplane_conformance_stream_t* stream = (xplane_conformance_stream_t*)data;
+
+    free_address(&stream->sim);
+    free_address(&stream->client);
+    g_free(stream);
+}
+
+static void xplane_conformance_stats_reset(void* tapdata)
+{
+    xplane_conformance_stats_t* stats = (xplane_conformance_stats_t*)tapdata;
+
+    g_hash_table_remove_all(stats->streams);
+}
+
+static tap_packet_status xplane_conformance_stats_packet(void* tapdata, packet_info* pinfo _U_, epan_dissect_t* edt _U_, const void* data, tap_flags_t flags _U_)
+{
+    xplane_conformance_stats_t* stats = (xplane_conformance_stats_t*)tapdata;
+    const xplane_cadence_tap_info_t* tap_info = (const xplane_cadence_tap_info_t*)data;
+    xplane_conformance_stream_t key;
+    key.sim = *tap_info->sim;
+    key.client = *tap_info->client;
+    key.port = tap_info->port;
+    key.stream = tap_info->stream;
+
+    xplane_conformance_stream_t* stream = (xplane_conformance_stream_t*)g_hash_table_lookup(stats->streams, &key);
+    if (stream == NULL)
+    {
+        stream = g_new0(xplane_conformance_stream_t, 1);
+        copy_address(&stream->sim, tap_info->sim);
+        copy_address(&stream->client, tap_info->client);
+        stream->port = tap_info->port;
+        stream->stream = tap_info->stream;
+        g_hash_table_insert(stats->streams, stream, stream);
+    }
+
+    stream->samples++;
+    if (tap_info->interval >= 0)
+        stream->counts[tap_info->kind]++;
+    stream->missing += tap_info->missing;
+    stream->longest = MAX(stream->longest, tap_info->interval);
+    if (tap_info->period > 0)
+    {
+        stream->period = tap_info->period;
+        stream->requested = tap_info->requested;
+    }
+    return TAP_PACKET_REDRAW;
+}
+
+static gint xplane_conformance_stream_compare(gconstpointer a, gconstpointer b)
+{
+    const xplane_conformance_stream_t* stream_a = *(const xplane_conformance_stream_t* const*)a;
+    const xplane_conformance_stream_t* stream_b = *(const xplane_conformance_stream_t* const*)b;
+    gint result = cmp_address(&stream_a->sim, &stream_b->sim);
+    if (result == 0)
+        result = cmp_address(&stream_a->client, &stream_b->client);
+    if (result == 0)
+        result = (gint)stream_a->port - (gint)stream_b->port;
+    return result != 0 ? result : (gint)stream_a->stream - (gint)stream_b->stream;
+}
+
+static void xplane_conformance_stats_draw(void* tapdata)
+{
+    const xplane_conformance_stats_t* stats = (const xplane_conformance_stats_t*)tapdata;
+    GPtrArray* sorted = g_ptr_array_sized_new(g_hash_table_size(stats->streams));
+    GHashTableIter iter;
+    gpointer entry;
+
+    g_hash_table_iter_init(&iter, stats->streams);
+    while (g_hash_table_iter_next(&iter, &entry, NULL))
+        g_ptr_array_add(sorted, entry);
+    g_ptr_array_sort(sorted, xplane_conformance_stream_compare);
+
+    printf("\n");
+    printf("======================================================================================================================================================\n");
+    printf("X-Plane Stream Conformance:\n");
+    printf("Filter: %s\n", stats->filter ? stats->filter : "");
+    printf("%-40s %-28s %-6s %12s %10s %10s %8s %8s %8s %8s %8s %9s\n", "Simulator", "Client", "Stream", "Period ms", "Samples", "On Time", "Late", "Burst", "Gaps", "Missing", "Max ms", "On Time %");
+
+    for (guint i = 0; i < sorted->len; i++)
+    {
+        const xplane_conformance_stream_t* stream = (const xplane_conformance_stream_t*)g_ptr_array_index(sorted, i);
+        char* sim = address_to_str(NULL, &stream->sim);
+        char* client = address_to_str(NULL, &stream->client);
+        char* endpoint = g_strdup_printf("%s:%u", client, stream->port);
+        char period[24] = "-";
+        char conformance[16] = "-";
+        guint64 on_time = stream->counts[xplane_INTERVAL_ON_TIME];
+        // Every sample that should have arrived once the period was known: the ones that did and the ones a gap lost.
+        guint64 expected = on_time + stream->counts[xplane_INTERVAL_LATE] + stream->counts[xplane_INTERVAL_GAP] + stream->counts[xplane_INTERVAL_BURST] + stream->missing;
+
+        if (stream->period > 0)
+            snprintf(period, sizeof period, "%.1f %s", stream->period * 1000, stream->requested ? "req" : "lrn");
+        if (expected > 0)
+            snprintf(conformance, sizeof conformance, "%.1f", 100.0 * on_time / expected);
+
+        printf("%-40.40s %-28.28s %-6s %12s %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT " %8" G_GUINT64_FORMAT " %8" G_GUINT64_FORMAT " %8" G_GUINT64_FORMAT " %8" G_GUINT64_FORMAT " %8.1f %9s\n",
+            sim, endpoint, xplane_stream_name(stream->stream), period, stream->samples, on_time, stream->counts[xplane_INTERVAL_LATE], stream->counts[xplane_INTERVAL_BURST],
+            stream->counts[xplane_INTERVAL_GAP], stream->missing, stream->longest * 1000, conformance);
+        g_free(endpoint);
+        wmem_free(NULL, client);
+        wmem_free(NULL, sim);
+    }
+    printf("======================================================================================================================================================\n");
+
+    g_ptr_array_free(sorted, TRUE);
+}
+
+static void xplane_conformance_stats_finish(void* tapdata)
+{
+    xplane_conformance_stats_t* stats = (xplane_conformance_stats_t*)tapdata;
+
+    g_hash_table_destroy(stats->streams);
+    g_free(stats->filter);
+    g_free(stats);
+}
+
+static void xplane_conformance_stats_init(const char* opt_arg, void* userdata _U_)
+{
+    const char* prefix = "xplane,conformance,";
+    xplane_conformance_stats_t* stats = g_new0(xplane_conformance_stats_t, 1);
+
+    if (strncmp(opt_arg, prefix, strlen(prefix)) == 0)
+        stats->filter = g_strdup(opt_arg + strlen(prefix));
+    // Keys and values are the same entry, so it's only freed once.
+    stats->streams = g_hash_table_new_full(xplane_conformance_stream_hash, xplane_conformance_stream_equal, NULL, xplane_conformance_stream_free);
+
+    GString* error = register_tap_listener(xplane_CADENCE_TAP_NAME, stats, stats->filter, 0, xplane_conformance_stats_reset, xplane_conformance_stats_packet, xplane_conformance_stats_draw, xplane_conformance_stats_finish);
+    if (error)
+    {
+        fprintf(stderr, "tshark: Couldn't register xplane,conformance tap: %s\n", error->str);
+        g_string_free(error, TRUE);
+        xplane_conformance_stats_finish(stats);
+    }
+}
+
+static stat_tap_ui xplane_conformance_stat_ui = {
+    REGISTER_STAT_GROUP_GENERIC,
+    NULL,
+    "xplane,conformance",
+    xplane_conformance_stats_init,
+    0,
+    NULL
+};
+
+void xplane_register_stats(void)
+{
+    register_stat_tap_ui(&xplane_data_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_rref_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_jitter_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_latency_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_action_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_flir_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_radr_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_track_stat_ui, NULL);
+    register_stat_tap_ui(&xplane_conformance_stat_ui, NULL);
+}
+
+/*
+ * Editor modelines  -  https://www.wireshark.org/tools/modelines.html
+ *
+ * Local variables:
+ * c-basic-offset: 4
+ * tab-width: 4
+ * indent-tabs-mode: nil
+ * End:
+ *
+ * vi: set shiftwidth=4 tabstop=4 expandtab:
+ * :indentSize=4:tabSize=4:noTabs=true:
+ */